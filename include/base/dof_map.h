@@ -32,6 +32,7 @@
 #include "libmesh/sparsity_pattern.h"
 #include "libmesh/parallel_object.h"
 #include "libmesh/point.h"
+#include "libmesh/simple_range.h"
 
 #ifdef LIBMESH_FORWARD_DECLARE_ENUMS
 namespace libMesh
@@ -48,6 +49,7 @@ enum Order : int;
 #include <iterator>
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <memory>
 
@@ -273,6 +275,96 @@ public:
    */
   bool constrained_sparsity_construction();
 
+  /**
+   * Sets whether the sparsity pattern should be kept in compressed
+   * sparse row form, as a \p SparsityPattern::CSRGraph, after it is
+   * computed.  This requires computing the exact pattern rather than
+   * an upper bound on the number of nonzeros per row, but gives
+   * matrices that support it (e.g. \p PetscMatrix) exact
+   * preallocation of their nonzero structure.  The compressed form
+   * is built directly, without the full \p SparsityPattern::Graph,
+   * unless a user sparsity augmentation function or object needs
+   * the latter.  If some attached matrix needs the full \p
+   * SparsityPattern::Graph, that is kept instead.  This is false by
+   * default.
+   */
+  void set_compressed_sparsity(bool use_csr);
+
+  /**
+   * Returns true iff the current policy is to keep the sparsity
+   * pattern in compressed sparse row form.
+   */
+  bool compressed_sparsity() const { return _compressed_sparsity; }
+
+  /**
+   * Sets whether the sparsity pattern may be computed in blocks of
+   * \p block_size() DoFs, when all variables are in one variable
+   * group.  This shrinks the pattern computation by the square of
+   * the block size, and lets blocked matrix types (e.g. \p BAIJ
+   * \p PetscMatrix) use the exact block structure.  The blocked
+   * pattern is skipped anyway when some matrix or sparsity
+   * augmentation needs rows of individual DoFs, or not all variables
+   * couple.  This is false by default.
+   */
+  void set_blocked_sparsity(bool use_blocks);
+
+  /**
+   * Returns true iff the current policy is to compute the sparsity
+   * pattern in blocks when possible.
+   */
+  bool blocked_sparsity() const { return _blocked_sparsity; }
+
+  /**
+   * Sets whether the sparsity pattern should be updated incrementally
+   * after adaptive mesh refinement: when it is next recomputed, only
+   * the rows near elements which were just refined or coarsened are
+   * rebuilt, and the other rows are carried over from the old
+   * pattern in the new DoF numbering.  This keeps the pattern in
+   * compressed sparse row form, so it implies \p
+   * set_compressed_sparsity(true).
+   *
+   * Finding the rows to rebuild, and rebuilding them, only looks at
+   * the mesh near the adapted elements.  Renumbering the carried over
+   * rows still takes one pass over the local DofObjects and the old
+   * local rows, and the matrices themselves are reallocated, since
+   * the new DoF numbering moves most of their column indices.
+   *
+   * This is only supported on a \p ReplicatedMesh, and is an error
+   * on a \p DistributedMesh.  The old pattern can only be reused if
+   * the DoFs were distributed exactly once since it was computed,
+   * the default coupling functor is the only one, no matrix needs
+   * the full sparsity pattern, there are no periodic boundaries,
+   * SCALAR variables or user sparsity augmentation, and every carried
+   * over row is still local; otherwise the whole pattern is
+   * recomputed as usual.  This is false by default.
+   */
+  void set_incremental_sparsity(bool use_incremental);
+
+  /**
+   * Returns true iff the current policy is to update the sparsity
+   * pattern incrementally after adaptive mesh refinement.
+   */
+  bool incremental_sparsity() const { return _incremental_sparsity; }
+
+  /**
+   * Returns true iff the last call to \p compute_sparsity() updated
+   * the previous sparsity pattern incrementally rather than
+   * recomputing all of it.
+   */
+  bool sparsity_updated_incrementally() const
+  { return _sparsity_updated_incrementally; }
+
+  /**
+   * The sorted global indices of the local rows which were rebuilt
+   * by the last call to \p compute_sparsity(), if it updated the
+   * previous pattern incrementally.  All other local rows have the
+   * same couplings as before, renumbered.  If the pattern was
+   * recomputed from scratch, every row should be assumed to have
+   * changed.
+   */
+  const std::vector<dof_id_type> & changed_sparsity_rows() const
+  { return _changed_sparsity_rows; }
+
   /**
    * Clears the sparsity pattern
    */
@@ -745,6 +837,40 @@ public:
   void dof_indices (const Elem * const elem,
                     std::vector<dof_id_type> & di) const;
 
+  /**
+   * Sets whether the degree of freedom indices of the active local
+   * and ghosted elements should be cached each time DoFs are
+   * distributed.  If so, \p dof_indices() on those elements copies
+   * the indices out of the cache rather than recomputing them from
+   * the nodes and element, which saves time when they are requested
+   * repeatedly, e.g. in every nonlinear iteration, at the cost of
+   * storing them all.  This is false by default.
+   */
+  void set_dof_indices_caching(bool use_cache);
+
+  /**
+   * Returns true iff the current policy is to cache element degree
+   * of freedom indices.
+   */
+  bool dof_indices_caching() const { return _dof_indices_caching; }
+
+  /**
+   * \returns \p true iff the degree of freedom indices of \p elem
+   * are cached.
+   */
+  bool has_cached_dof_indices (const Elem & elem) const;
+
+  /**
+   * \returns The cached global degree of freedom indices of \p
+   * elem, for variable \p vn, or for all variables if \p vn is \p
+   * invalid_uint, in the same order \p dof_indices() gives them.
+   * This avoids even copying them into a vector.  \p elem must be
+   * cached; see \p has_cached_dof_indices().
+   */
+  SimpleRange<const dof_id_type *>
+  cached_dof_indices (const Elem & elem,
+                      const unsigned int vn = libMesh::invalid_uint) const;
+
   /**
    * Fills the vector \p di with the global degree of freedom indices
    * for the element.  For one variable, and potentially for a
@@ -1496,6 +1622,47 @@ public:
 
 private:
 
+  /**
+   * \returns The number of DoFs which the sparsity pattern treats as
+   * one dense block: \p block_size() if \p blocked_sparsity() is
+   * set, unless some matrix or sparsity augmentation needs rows of
+   * individual DoFs, or not all variables couple; otherwise 1.
+   */
+  unsigned int sparsity_block_size() const;
+
+  /**
+   * Fills the element degree of freedom indices cache, after DoFs
+   * have been distributed.
+   */
+  void build_dof_indices_cache (const MeshBase & mesh);
+
+  /**
+   * Empties the element degree of freedom indices cache.
+   */
+  void clear_dof_indices_cache ();
+
+  /**
+   * \returns The cached degree of freedom indices in cache slot \p
+   * slot, for variable \p vn or for all variables.
+   */
+  SimpleRange<const dof_id_type *>
+  _cached_dof_indices (const dof_id_type slot,
+                       const unsigned int vn) const;
+
+#ifdef LIBMESH_ENABLE_AMR
+  /**
+   * Updates the compressed sparsity pattern \p _old_sp, computed
+   * before the last refinement and coarsening of the mesh, by
+   * rebuilding the rows near the adapted elements and renumbering
+   * the rest.  Fills \p _changed_sparsity_rows.
+   *
+   * \returns The updated pattern, in compressed sparse row form, or
+   * \p nullptr on every processor if the old pattern can't be
+   * reused.
+   */
+  std::unique_ptr<SparsityPattern::Build> update_sparsity(const MeshBase & mesh);
+#endif
+
   /**
    * Helper function that gets the dof indices on the current element
    * for a non-SCALAR type variable, where the variable is identified
@@ -1682,6 +1849,55 @@ private:
    */
   bool _constrained_sparsity_construction;
 
+  /**
+   * This flag indicates whether or not we keep the sparsity pattern
+   * in compressed sparse row form.
+   */
+  bool _compressed_sparsity;
+
+  /**
+   * This flag indicates whether or not we compute the sparsity
+   * pattern in blocks of \p block_size() DoFs when possible.
+   */
+  bool _blocked_sparsity;
+
+  /**
+   * This flag indicates whether or not we update the sparsity pattern
+   * incrementally after adaptive mesh refinement.
+   */
+  bool _incremental_sparsity;
+
+  /**
+   * Whether the last sparsity pattern computed was an incremental
+   * update of the one before.
+   */
+  bool _sparsity_updated_incrementally;
+
+  /**
+   * The local rows rebuilt by the last incremental sparsity update.
+   */
+  std::vector<dof_id_type> _changed_sparsity_rows;
+
+  /**
+   * This flag indicates whether or not we cache the degree of freedom
+   * indices of local and ghosted elements.
+   */
+  bool _dof_indices_caching;
+
+  /**
+   * The position in the cache of each cached element, by id.
+   */
+  std::unordered_map<dof_id_type, dof_id_type> _dof_indices_cache_slots;
+
+  /**
+   * The cached degree of freedom indices of element slot \p s for
+   * variable \p v start at \p _dof_indices_cache_offsets[s*n_vars+v]
+   * in \p _dof_indices_cache.
+   */
+  std::vector<std::size_t> _dof_indices_cache_offsets;
+
+  std::vector<dof_id_type> _dof_indices_cache;
+
   /**
    * The finite element type for each variable.
    */
@@ -1860,6 +2076,28 @@ private:
    */
   std::vector<dof_id_type> _first_old_scalar_df;
 
+  /**
+   * The sparsity pattern from before the last call to \p
+   * clear_sparsity(), kept for an incremental update if \p
+   * _incremental_sparsity is set.
+   */
+  std::unique_ptr<SparsityPattern::Build> _old_sp;
+
+  /**
+   * The number of times DoFs have been distributed since the sparsity
+   * pattern was last computed.
+   */
+  unsigned int _n_distributions_since_sparsity;
+
+  /**
+   * The ids of the active elements which had just been refined or
+   * coarsened, in h or p, when DoFs were last distributed.  Only
+   * recorded if \p _incremental_sparsity is set; we can't rely on
+   * the refinement flags still being there when the sparsity pattern
+   * is recomputed, since \p MeshBase::contract() clears them.
+   */
+  std::vector<dof_id_type> _adapted_elem_ids;
+
 #endif
 
 #ifdef LIBMESH_ENABLE_CONSTRAINTS
@@ -2129,6 +2367,22 @@ void DofMap::set_constrained_sparsity_construction(bool use_constraints)
 
 
 
+inline
+void DofMap::set_compressed_sparsity(bool use_csr)
+{
+  _compressed_sparsity = use_csr;
+}
+
+
+
+inline
+void DofMap::set_blocked_sparsity(bool use_blocks)
+{
+  _blocked_sparsity = use_blocks;
+}
+
+
+
 inline
 bool DofMap::constrained_sparsity_construction()
 {
@@ -28,6 +28,10 @@
 #include "libmesh/libmesh.h" // libMesh::invalid_uint
 #include "libmesh/reference_counted_object.h"
 
+#ifdef LIBMESH_ENABLE_DOF_OBJECT_ARENA
+#include "libmesh/arena_allocator.h"
+#endif
+
 // C++ includes
 #include <cstddef>
 #include <cstring>
@@ -625,9 +629,20 @@ private:
    * [-5 11 11 13 17 () (ncv_0 idx_0 ncv_1 idx_1 ncv_2 idx_2) () (ncv_0 idx_0) (ncv_0 idx_0 ncv_1 idx_1) (xtra1 xtra2)]
    * [0   1  2  3  4         5     6     7     8     9    10         11    12      13    14    15    16      17    18]
    * \endverbatim
+   *
+   * If libMesh is configured with --enable-dof-object-arena, the
+   * buffers of all DofObjects are allocated from the shared \p
+   * ArenaPool rather than each being its own heap allocation.  This
+   * is only a pooled allocator: each buffer is still a \p
+   * std::vector, with its own pointer, size and capacity, rather than
+   * an offset into storage owned by the mesh.
    */
   typedef dof_id_type index_t;
+#ifdef LIBMESH_ENABLE_DOF_OBJECT_ARENA
+  typedef std::vector<index_t, ArenaAllocator<index_t>> index_buffer_t;
+#else
   typedef std::vector<index_t> index_buffer_t;
+#endif
   index_buffer_t _idx_buf;
 
   /**
@@ -666,7 +681,7 @@ private:
 #ifdef LIBMESH_IS_UNIT_TESTING
 public:
   void set_buffer (const std::vector<dof_id_type> & buf)
-  { _idx_buf = buf; }
+  { _idx_buf.assign(buf.begin(), buf.end()); }
 #endif
 };
 
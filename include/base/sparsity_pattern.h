@@ -52,6 +52,60 @@ class Graph : public std::vector<Row> {};
 
 class NonlocalGraph : public std::map<dof_id_type, Row> {};
 
+/**
+ * The same rows as a \p Graph, packed in compressed sparse row
+ * format: the sorted global column indices of local row \p r are
+ * stored in \p columns from \p row_offsets[r] up to \p
+ * row_offsets[r+1].  This avoids the per-row allocations of a \p
+ * Graph, and is the layout taken directly by e.g. PETSc CSR
+ * preallocation.
+ */
+class CSRGraph
+{
+public:
+  /**
+   * The offset of the start of each row in \p columns, followed by
+   * the total number of nonzeros.  These may exceed the range of
+   * \p dof_id_type on a processor with many local nonzeros.
+   */
+  std::vector<std::size_t> row_offsets;
+
+  /**
+   * The column indices of all the rows, one row after another.
+   */
+  std::vector<dof_id_type> columns;
+
+  /**
+   * \returns The number of rows stored.
+   */
+  dof_id_type n_rows () const
+  { return row_offsets.empty() ? 0 : cast_int<dof_id_type>(row_offsets.size() - 1); }
+
+  /**
+   * \returns The total number of nonzeros stored.
+   */
+  std::size_t n_nonzeros () const { return columns.size(); }
+
+  /**
+   * \returns Pointers to the beginning and end of the column indices
+   * of row \p r.
+   */
+  const dof_id_type * row_begin (dof_id_type r) const
+  { libmesh_assert_less (r, n_rows()); return columns.data() + row_offsets[r]; }
+
+  const dof_id_type * row_end (dof_id_type r) const
+  { libmesh_assert_less (r, n_rows()); return columns.data() + row_offsets[r+1]; }
+
+  /**
+   * Frees all storage.
+   */
+  void clear ()
+  {
+    std::vector<std::size_t>().swap(row_offsets);
+    std::vector<dof_id_type>().swap(columns);
+  }
+};
+
 /**
  * Splices the two sorted ranges [begin,middle) and [middle,end)
  * into one sorted range [begin,end).  This method is much like
@@ -106,7 +160,8 @@ public:
          const std::set<GhostingFunctor *> & coupling_functors_in,
          const bool implicit_neighbor_dofs_in,
          const bool need_full_sparsity_pattern_in,
-         const bool calculate_constrained_in = false);
+         const bool calculate_constrained_in = false,
+         const unsigned int block_size_in = 1);
 
   /**
    * Special functions.
@@ -144,7 +199,8 @@ public:
 
   /**
    * Rows of sparse matrix indices, indexed by the offset from the
-   * first DoF on this processor.
+   * first DoF on this processor.  If \p get_block_size() is greater
+   * than one, these are rows of blocks rather than of DoFs.
    */
   const SparsityPattern::Graph & get_sparsity_pattern() const
   { return sparsity_pattern; }
@@ -157,6 +213,14 @@ public:
   const SparsityPattern::NonlocalGraph & get_nonlocal_pattern() const
   { return nonlocal_pattern; }
 
+  /**
+   * Rows of sparse matrix indices in compressed sparse row format,
+   * indexed by the offset from the first DoF on this processor.
+   * Empty unless \p compress_sparsity() has been called.
+   */
+  const SparsityPattern::CSRGraph & get_csr_pattern() const
+  { return csr_pattern; }
+
   /**
    * The number of on-processor nonzeros in my portion of the
    * global matrix.
@@ -171,6 +235,18 @@ public:
   const std::vector<dof_id_type> & get_n_oz() const
   { return n_oz; }
 
+  /**
+   * The number of consecutive DoFs which are treated as one dense
+   * block.  If this is greater than one, the sparsity pattern is
+   * computed and stored for whole blocks, with block row \p b and
+   * block column \p c standing for DoFs \p b*block_size to \p
+   * (b+1)*block_size-1 and \p c*block_size to \p
+   * (c+1)*block_size-1, while \p get_n_nz() and \p get_n_oz() still
+   * count individual entries.
+   */
+  unsigned int get_block_size() const
+  { return block_size; }
+
   /**
    * Let a user-provided AugmentSparsityPattern subclass modify our
    * sparsity structure.
@@ -185,7 +261,10 @@ public:
                                                    std::vector<dof_id_type> & n_oz,
                                                    void * context),
                                       void * context)
-  { func(sparsity_pattern, n_nz, n_oz, context); }
+  {
+    libmesh_assert_equal_to (block_size, 1);
+    func(sparsity_pattern, n_nz, n_oz, context);
+  }
 
   /**
    * Clear the "full" details of our sparsity structure, leaving only
@@ -195,8 +274,50 @@ public:
   {
     sparsity_pattern.clear();
     nonlocal_pattern.clear();
+    csr_pattern.clear();
   }
 
+  /**
+   * Replace the full sparsity pattern, which must already have been
+   * synchronized with \p parallel_sync(), by its compressed sparse
+   * row form.  Does nothing if the pattern is already compressed.
+   * Both forms are held at once here, so when nothing needs the
+   * full pattern \p build_csr() should be used instead.
+   */
+  void compress_sparsity();
+
+  /**
+   * Computes the sparsity pattern of the elements in \p range
+   * directly in compressed sparse row form, synchronized across
+   * processors, without ever building the full \p Graph.
+   *
+   * A threaded pass over the elements bounds the length of each
+   * row from the element couplings.  Threaded fill passes then
+   * insert the columns of each row, sorted and without duplicates,
+   * into a slot of that bounded length: first over a few groups of
+   * rows at a time, each in a scratch array, only to find the exact
+   * row lengths, and finally straight into the exact column array.
+   * The peak memory use is thus about that of the exact column array,
+   * at the cost of a few more loops over the elements; only rows
+   * owned by other processors are stored as separate rows, until
+   * they are sent.
+   *
+   * This is incompatible with user sparsity augmentation, which
+   * needs the full pattern.
+   */
+  void build_csr(const ConstElemRange & range);
+
+  /**
+   * Compresses our full sparsity pattern, which must already have
+   * been synchronized with \p parallel_sync(), into compressed sparse
+   * row form, taking each row from the same row of \p rows instead
+   * if that is not empty, and recounting its nonzeros.  This lets
+   * rows carried over from an older pattern be combined with rows
+   * recomputed from only part of the mesh, without copying either
+   * into the full pattern first.
+   */
+  void replace_rows(const SparsityPattern::CSRGraph & rows);
+
 private:
   const DofMap & dof_map;
   const CouplingMatrix * dof_coupling;
@@ -204,6 +325,7 @@ private:
   const bool implicit_neighbor_dofs;
   const bool need_full_sparsity_pattern;
   const bool calculate_constrained;
+  const unsigned int block_size;
 
   // If there are "spider" nodes in the mesh (i.e. a single node which
   // is connected to many 1D elements) and Constraints, we can end up
@@ -223,6 +345,69 @@ private:
                              std::vector<dof_id_type> & dofs_vi,
                              unsigned int vi);
 
+  void sorted_connected_blocks(const Elem * elem,
+                               std::vector<dof_id_type> & blocks);
+
+  /**
+   * Adds the numbers of on- and off-processor entries of the row
+   * stored from \p row_begin to \p row_end to \p n_nz and \p n_oz
+   * for each DoF of local (block) row \p r.
+   */
+  void count_row(const dof_id_type r,
+                 const dof_id_type * row_begin,
+                 const dof_id_type * row_end);
+
+  /**
+   * Merges the sorted indices from \p begin to \p end into local
+   * row \p r of the pattern being filled by \p build_csr(), if that
+   * row is among those being filled.
+   */
+  void add_to_csr_row(const dof_id_type r,
+                      const dof_id_type * begin,
+                      const dof_id_type * end);
+
+  /**
+   * Runs a fill pass of \p build_csr() over the elements in \p
+   * range and the rows received from other processors.
+   */
+  void fill_csr_rows(const ConstElemRange & range);
+
+  /**
+   * Which structure the element loop in \p operator() adds to: the
+   * full \p Graph, or, for \p build_csr(), the row lengths or
+   * the columns of the rows being filled.
+   */
+  enum BuildPass { FULL_GRAPH, COUNT_CSR, FILL_CSR };
+
+  BuildPass pass;
+
+  /**
+   * The rows being filled by a fill pass of \p build_csr(): local
+   * rows \p first_row up to \p end_row, the row \p r stored from
+   * \p columns + \p offsets[r - first_row], with \p sizes[r -
+   * first_row] columns inserted so far.  This is shared by all the
+   * threads of the pass, which lock the mutex of a row while they
+   * insert into it.
+   */
+  struct CSRFill
+  {
+    dof_id_type first_row, end_row;
+    const std::size_t * offsets;
+    dof_id_type * columns;
+    std::vector<dof_id_type> sizes;
+
+    static const unsigned int n_mutexes = 256;
+    Threads::spin_mutex row_mutexes[n_mutexes];
+  };
+
+  CSRFill * csr_fill;
+
+  /**
+   * Rows received from other processors during \p build_csr(),
+   * keyed by local row, until the fill pass merges them in.
+   */
+  NonlocalGraph received_pattern;
+
 #ifndef LIBMESH_ENABLE_DEPRECATED
 private:
 #endif
@@ -231,6 +416,8 @@ private:
 
   SparsityPattern::NonlocalGraph nonlocal_pattern;
 
+  SparsityPattern::CSRGraph csr_pattern;
+
   std::vector<dof_id_type> n_nz;
 
   std::vector<dof_id_type> n_oz;
@@ -22,6 +22,7 @@
 
 // Local includes
 #include "libmesh/fe_base.h"
+#include "libmesh/fe_shape_cache.h"
 #include "libmesh/int_range.h"
 #include "libmesh/libmesh.h"
 
@@ -562,6 +563,8 @@ public:
 
 protected:
 
+  virtual bool map_batch_supported() const override { return true; }
+
   /**
    * Update the various member data fields \p phi,
    * \p dphidxi, \p dphideta, \p dphidzeta, etc.
@@ -577,6 +580,15 @@ protected:
    */
   void init_dual_shape_functions(unsigned int n_shapes, unsigned int n_qp);
 
+  /**
+   * \returns The shared \p FEShapeCache table of reference shape
+   * function data at the points \p qp on \p elem, building and
+   * inserting it if necessary, or \p nullptr if our shape functions
+   * at \p qp can't be shared with other \p FE objects.
+   */
+  const FEShapeCache::Table * shape_cache_table(const std::vector<Point> & qp,
+                                                const Elem * elem);
+
 #ifdef LIBMESH_ENABLE_INFINITE_ELEMENTS
 
   /**
@@ -850,6 +862,14 @@ public:
    */
   static void init_subdivision_matrix(DenseMatrix<Real> & A,
                                       unsigned int valence);
+
+protected:
+
+  /**
+   * Subdivision elements aren't mapped through their own nodes
+   * alone.
+   */
+  virtual bool map_batch_supported() const override { return false; }
 };
 
 
@@ -1043,6 +1063,12 @@ protected:
   virtual void init_shape_functions(const std::vector<Point> & qp,
                                     const Elem * e) override;
 
+  /**
+   * XYZ shape functions depend on the physical points, so we map
+   * each element as usual rather than from a batch.
+   */
+  virtual bool map_batch_supported() const override { return false; }
+
   /**
    * After having updated the jacobian and the transformation
    * from local to global coordinates in \p FEAbstract::compute_map(),
@@ -62,6 +62,7 @@ class BoundaryInfo;
 class DofConstraints;
 class DofMap;
 class Elem;
+class FEAffineMapBatch;
 class MeshBase;
 template <typename T> class NumericVector;
 class QBase;
@@ -150,6 +151,17 @@ public:
                        const std::vector<Point> * const pts = nullptr,
                        const std::vector<Real> * const weights = nullptr) = 0;
 
+  /**
+   * Reinitializes the physical element-dependent data on element \p e
+   * of \p batch, at the quadrature points of \p qrule, taking the
+   * map data from \p batch rather than recomputing it.  \p batch must
+   * have been computed with a quadrature rule equivalent to \p qrule.
+   * Families whose maps aren't plain affine maps (\p XYZ, \p
+   * SUBDIVISION and infinite elements) compute their maps as usual.
+   */
+  void batch_reinit (const FEAffineMapBatch & batch,
+                     unsigned int e);
+
   /**
    * Reinitializes all the physical element-dependent data based on
    * the \p side of the element \p elem.  The \p tolerance parameter
@@ -707,6 +719,29 @@ protected:
    */
   bool shapes_on_quadrature;
 
+  /**
+   * A flag indicating that \p phi already holds the reference shape
+   * function values from an \p FEShapeCache table, which are
+   * independent of the element geometry, so that they need not be
+   * recomputed on every reinit.
+   */
+  bool phi_from_shape_cache;
+
+  /**
+   * The batch, if any, from which the map of the element currently
+   * being reinitialized should be taken, and the index of the element
+   * in it.  These are only set during \p batch_reinit().
+   */
+  const FEAffineMapBatch * _map_batch;
+  unsigned int _map_batch_index;
+
+  /**
+   * \returns \p true if \p reinit() takes the map from \p _map_batch
+   * when one is set.  Otherwise \p batch_reinit() falls back to an
+   * ordinary \p reinit().
+   */
+  virtual bool map_batch_supported() const { return false; }
+
   /**
    * \returns \p true when the shape functions (for
    * this \p FEFamily) depend on the particular
@@ -0,0 +1,210 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2021 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FE_AFFINE_MAP_BATCH_H
+#define LIBMESH_FE_AFFINE_MAP_BATCH_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <vector>
+
+namespace libMesh
+{
+
+// forward declarations
+class Elem;
+class QBase;
+
+/**
+ * This class computes the reference-to-physical map of a block of
+ * elements of the same type with affine maps all at once.  Where \p
+ * FEMap stores one element's data at each quadrature point as arrays
+ * of \p Point and \p Real, \p FEAffineMapBatch stores each component
+ * of the Jacobian, of its inverse and of the physical quadrature
+ * points as a separate contiguous array over the elements of the
+ * batch, so that the computation vectorizes across elements.
+ *
+ * Since the map is affine, the Jacobian and its inverse are stored
+ * once per element, with index \p e.  Quantities that vary over the
+ * quadrature points, \p JxW and \p xyz, are stored with index \p
+ * qp*n_elem()+e.
+ *
+ * Use \p FEAbstract::batch_reinit() to reinitialize an \p FE object
+ * on one element of the batch without recomputing its map.
+ *
+ * \date 2021
+ * \brief Structure-of-arrays affine maps for many elements at once.
+ */
+class FEAffineMapBatch
+{
+public:
+
+  /**
+   * Constructor.  Elements with a Jacobian less than or equal to \p
+   * jtol are considered to be invalid, as in \p FEMap.
+   */
+  FEAffineMapBatch (Real jtol = 0);
+
+  /**
+   * Computes the map of every element in \p elems at the points of
+   * \p qrule, which is initialized for their element type.  All of
+   * the elements must have the same type and p refinement level, a
+   * Lagrange mapping and an affine map.
+   */
+  void compute (const std::vector<const Elem *> & elems,
+                QBase & qrule);
+
+  /**
+   * \returns The number of elements in the batch.
+   */
+  unsigned int n_elem () const
+  { return cast_int<unsigned int>(_elems.size()); }
+
+  /**
+   * \returns The number of quadrature points per element.
+   */
+  unsigned int n_qp () const
+  { return cast_int<unsigned int>(_qw.size()); }
+
+  /**
+   * \returns The dimension of the elements in the batch.
+   */
+  unsigned int dim () const
+  { return _dim; }
+
+  /**
+   * \returns The \p e th element of the batch.
+   */
+  const Elem * elem (unsigned int e) const
+  { return _elems[e]; }
+
+  /**
+   * \returns The quadrature weights the batch was computed with.
+   */
+  const std::vector<Real> & get_weights () const
+  { return _qw; }
+
+  /**
+   * \returns The derivatives of physical coordinate \p comp with
+   * respect to reference coordinate \p ref, e.g. dy/dxi for \p ref
+   * = 0 and \p comp = 1, for every element.
+   */
+  const std::vector<Real> & get_dxyzdref (unsigned int ref,
+                                          unsigned int comp) const
+  { libmesh_assert_less(ref, 3); libmesh_assert_less(comp, 3); return _dxyzdref[ref][comp]; }
+
+  /**
+   * \returns The derivatives of reference coordinate \p ref with
+   * respect to physical coordinate \p comp, e.g. deta/dx for \p ref
+   * = 1 and \p comp = 0, for every element.
+   */
+  const std::vector<Real> & get_drefdxyz (unsigned int ref,
+                                          unsigned int comp) const
+  { libmesh_assert_less(ref, 3); libmesh_assert_less(comp, 3); return _drefdxyz[ref][comp]; }
+
+  /**
+   * \returns The Jacobian of every element.
+   */
+  const std::vector<Real> & get_jacobian () const
+  { return _jac; }
+
+  /**
+   * \returns The Jacobian times the quadrature weight, indexed by \p
+   * qp*n_elem()+e.
+   */
+  const std::vector<Real> & get_JxW () const
+  { return _JxW; }
+
+  /**
+   * \returns Physical coordinate \p comp of the quadrature points,
+   * indexed by \p qp*n_elem()+e.
+   */
+  const std::vector<Real> & get_xyz (unsigned int comp) const
+  { libmesh_assert_less(comp, 3); return _xyz[comp]; }
+
+  /**
+   * Set the Jacobian tolerance used for determining when the mapping
+   * fails.
+   */
+  void set_jacobian_tolerance (Real tol) { _jacobian_tolerance = tol; }
+
+private:
+
+  /**
+   * Reports the element with a bad Jacobian, mirroring \p FEMap.
+   */
+  void jacobian_error (unsigned int e, Real bad_jac) const;
+
+  /**
+   * The elements in the batch.
+   */
+  std::vector<const Elem *> _elems;
+
+  /**
+   * The quadrature weights.
+   */
+  std::vector<Real> _qw;
+
+  /**
+   * The dimension of the elements in the batch.
+   */
+  unsigned int _dim;
+
+  /**
+   * Scratch space for the node coordinates, indexed by
+   * \p node*n_elem()+e.
+   */
+  std::vector<Real> _node_xyz[3];
+
+  /**
+   * Map derivatives, see \p get_dxyzdref().
+   */
+  std::vector<Real> _dxyzdref[3][3];
+
+  /**
+   * Inverse map derivatives, see \p get_drefdxyz().
+   */
+  std::vector<Real> _drefdxyz[3][3];
+
+  /**
+   * Jacobians, see \p get_jacobian().
+   */
+  std::vector<Real> _jac;
+
+  /**
+   * Jacobians times quadrature weights, see \p get_JxW().
+   */
+  std::vector<Real> _JxW;
+
+  /**
+   * Physical quadrature points, see \p get_xyz().
+   */
+  std::vector<Real> _xyz[3];
+
+  /**
+   * The Jacobian tolerance, see \p set_jacobian_tolerance().
+   */
+  Real _jacobian_tolerance;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_FE_AFFINE_MAP_BATCH_H
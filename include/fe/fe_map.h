@@ -35,6 +35,7 @@ namespace libMesh
 // forward declarations
 class Elem;
 class Node;
+class FEAffineMapBatch;
 
 /**
  * Class contained in FE that encapsulates mapping (i.e. from physical
@@ -88,6 +89,16 @@ public:
                                   const std::vector<Real> & qw,
                                   const Elem * elem);
 
+  /**
+   * Fills in the map data for element \p e of \p batch, which must
+   * have been computed with weights \p qw, from the data already
+   * computed there instead of from the element nodes.
+   */
+  void compute_batch_map(const unsigned int dim,
+                         const std::vector<Real> & qw,
+                         const FEAffineMapBatch & batch,
+                         unsigned int e);
+
   /**
    * Assign a fake jacobian and some other additional data fields.
    * Takes the integration weights as input.  For use on non-element
@@ -0,0 +1,181 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2021 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FE_SHAPE_CACHE_H
+#define LIBMESH_FE_SHAPE_CACHE_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/fe_type.h"
+#include "libmesh/point.h"
+
+#ifdef LIBMESH_FORWARD_DECLARE_ENUMS
+namespace libMesh
+{
+enum ElemType : int;
+enum QuadratureType : int;
+}
+#else
+#include "libmesh/enum_elem_type.h"
+#include "libmesh/enum_quadrature_type.h"
+#endif
+
+// C++ includes
+#include <memory>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * This class provides a process-wide, thread-safe store of reference
+ * element shape function tables.  When the shape functions of a
+ * finite element family do not depend on the particular element
+ * (i.e. \p FEAbstract::shapes_need_reinit() is \p false), their
+ * values and reference derivatives at the points of a quadrature rule
+ * depend only on the element type, the \p FEType, the p refinement
+ * level and the rule itself.  \p FE objects look their tables up here
+ * instead of re-evaluating every shape function whenever their
+ * element type changes, so every \p FE object on every thread shares
+ * a single evaluation.
+ *
+ * Tables are immutable once inserted, so pointers returned by \p
+ * find() and \p insert() remain valid until \p clear() is called.
+ *
+ * \date 2021
+ * \brief Shared cache of reference shape function values.
+ */
+class FEShapeCache
+{
+public:
+  /**
+   * Everything besides the quadrature points themselves that
+   * determines the contents of a \p Table.
+   */
+  struct Key
+  {
+    unsigned int dim;
+    ElemType elem_type;
+    FEType fe_type;
+    unsigned int p_level;
+    QuadratureType qrule_type;
+    Order qrule_order;
+    unsigned int n_qp;
+    bool second_derivatives;
+
+    bool operator< (const Key & other) const;
+  };
+
+  /**
+   * Reference shape function data for every shape function at
+   * every quadrature point, stored contiguously with the quadrature
+   * point index varying fastest.
+   */
+  struct Table
+  {
+    /**
+     * The number of shape functions in the table.
+     */
+    unsigned int n_shapes;
+
+    /**
+     * The number of quadrature points in the table.
+     */
+    unsigned int n_qp;
+
+    /**
+     * The reference element points the table was evaluated at.
+     */
+    std::vector<Point> points;
+
+    /**
+     * Shape function values.
+     */
+    std::vector<Real> phi;
+
+    /**
+     * Shape function derivatives with respect to xi, eta and zeta.
+     */
+    std::vector<Real> dphiref[3];
+
+#ifdef LIBMESH_ENABLE_SECOND_DERIVATIVES
+    /**
+     * Shape function second derivatives, in the order
+     * xi-xi, xi-eta, eta-eta, xi-zeta, eta-zeta, zeta-zeta used by
+     * \p FE::shape_second_deriv().
+     */
+    std::vector<Real> d2phiref[6];
+#endif
+
+    /**
+     * \returns A pointer to the \p n_qp values of \p data belonging to
+     * shape function \p i.
+     */
+    const Real * shape_values (const std::vector<Real> & data,
+                               unsigned int i) const
+    { return data.data() + static_cast<std::size_t>(i) * n_qp; }
+  };
+
+  /**
+   * \returns The table stored for \p key, or \p nullptr if there is
+   * none or if it was evaluated at points other than \p points.
+   */
+  static const Table * find (const Key & key,
+                             const std::vector<Point> & points);
+
+  /**
+   * Stores \p table for \p key, unless a table for \p key already
+   * exists, in which case \p table is discarded.
+   *
+   * \returns The table stored for \p key, or \p nullptr if that
+   * table was evaluated at points other than those of \p table.
+   */
+  static const Table * insert (const Key & key,
+                               std::unique_ptr<Table> table);
+
+  /**
+   * Removes all stored tables.  This invalidates every pointer
+   * previously returned, so it must not be called while \p FE
+   * objects are being reinitialized on other threads.
+   */
+  static void clear ();
+
+  /**
+   * \returns The number of tables currently stored.
+   */
+  static std::size_t size ();
+
+  /**
+   * Enables or disables use of the cache by \p FE objects.  The
+   * cache is enabled by default.  These are safe to call while other
+   * threads are reinitializing \p FE objects; tables already built
+   * stay in the cache either way.
+   */
+  static void enable ();
+  static void disable ();
+
+  /**
+   * \returns \p true if \p FE objects should use the cache.
+   */
+  static bool enabled ();
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_FE_SHAPE_CACHE_H
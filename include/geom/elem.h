@@ -138,6 +138,17 @@ public:
    */
   virtual ~Elem();
 
+#ifdef LIBMESH_ENABLE_MESH_OBJECT_ARENA
+  /**
+   * Elements are allocated from \p ArenaPool::mesh_object_instance(),
+   * so building them takes no system allocation and elements of one
+   * type sit next to each other in memory.
+   */
+  static void * operator new (std::size_t size);
+
+  static void operator delete (void * p, std::size_t size);
+#endif
+
   /**
    * \returns The \p Point associated with local \p Node \p i.
    */
@@ -100,6 +100,17 @@ public:
    */
   ~Node ();
 
+#ifdef LIBMESH_ENABLE_MESH_OBJECT_ARENA
+  /**
+   * Nodes are allocated from \p ArenaPool::mesh_object_instance(), so
+   * building them takes no system allocation and nodes built one
+   * after another sit next to each other in memory.
+   */
+  static void * operator new (std::size_t size);
+
+  static void operator delete (void * p, std::size_t size);
+#endif
+
   /**
    * Assign to a node from a point.
    */
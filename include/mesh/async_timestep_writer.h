@@ -0,0 +1,183 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2021 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_ASYNC_TIMESTEP_WRITER_H
+#define LIBMESH_ASYNC_TIMESTEP_WRITER_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/parallel_object.h"
+
+// C++ includes
+#include <deque>
+#include <exception>
+#include <set>
+#include <string>
+#include <vector>
+#ifdef LIBMESH_HAVE_CXX11_THREAD
+# include <condition_variable>
+# include <mutex>
+# include <thread>
+#endif
+
+namespace libMesh
+{
+
+// Forward declarations
+class EquationSystems;
+class ExodusII_IO;
+
+/**
+ * Writes the time steps of an ExodusII file in the background.
+ *
+ * The first time step goes through ExodusII_IO::write_timestep() as
+ * usual, since that also writes the mesh.  For each later step,
+ * write_timestep() only takes a snapshot of the nodal solution on
+ * processor 0 and returns; a thread there formats and writes queued
+ * snapshots in order while the computation moves on.  At most \p
+ * max_pending snapshots are held at once: when the queue is full,
+ * write_timestep() waits for the oldest one to be written.
+ *
+ * Only the output variables are gathered for a snapshot, straight to
+ * processor 0 from the processors owning them.  Processor 0 writes
+ * the whole file, so it has to hold those values anyway, as it does
+ * when writing synchronously.
+ *
+ * None of the libraries under ExodusII is thread-safe, so the thread
+ * holds an ExodusII_IO_Helper::IOLock while it writes, as does every
+ * ExodusII_IO and Nemesis_IO function that touches a file.  Other
+ * Exodus input and output may therefore go on meanwhile, though it
+ * waits for any snapshot being written.
+ *
+ * Call fence() before anything that needs the file to be complete,
+ * e.g. a checkpoint, and before using the ExodusII_IO object
+ * directly again.  An error in the background thread is reported by
+ * the next write_timestep() or fence().  The destructor finishes all
+ * pending writes.
+ *
+ * Without std::thread support, snapshots are written immediately.
+ *
+ * \date 2021
+ * \brief Background writer for ExodusII time steps.
+ */
+class AsyncTimestepWriter : public ParallelObject
+{
+public:
+
+  /**
+   * Constructor.  Time steps will be written with \p io, holding at
+   * most \p max_pending unwritten snapshots.
+   */
+  AsyncTimestepWriter (ExodusII_IO & io,
+                       unsigned int max_pending = 2);
+
+  /**
+   * Destructor.  Waits for all pending time steps to be written.
+   */
+  ~AsyncTimestepWriter ();
+
+  AsyncTimestepWriter (const AsyncTimestepWriter &) = delete;
+  AsyncTimestepWriter & operator= (const AsyncTimestepWriter &) = delete;
+
+  /**
+   * Queues the solution of \p es for writing as time step \p
+   * timestep at \p time.  The arguments are those of
+   * ExodusII_IO::write_timestep().  Collective.
+   */
+  void write_timestep (const std::string & fname,
+                       const EquationSystems & es,
+                       const int timestep,
+                       const Real time,
+                       const std::set<std::string> * system_names=nullptr);
+
+  /**
+   * Waits until every queued time step is in the file, and throws if
+   * writing any of them failed.  Collective.
+   */
+  void fence ();
+
+  /**
+   * \returns The number of snapshots waiting to be written on this
+   * processor.
+   */
+  std::size_t n_pending () const;
+
+private:
+
+  /**
+   * A queued time step.
+   */
+  struct Snapshot
+  {
+    std::string fname;
+    std::vector<Number> soln;
+    std::vector<std::string> names;
+    int timestep;
+    Real time;
+  };
+
+  /**
+   * Writes \p snapshot, catching any error for later.
+   */
+  void write (const Snapshot & snapshot);
+
+  /**
+   * Rethrows any error caught so far, on every processor.
+   */
+  void check_error ();
+
+  /**
+   * The body of the background thread.
+   */
+  void run ();
+
+  ExodusII_IO & _io;
+
+  const std::size_t _max_pending;
+
+  /**
+   * Snapshots not yet written; the front one may be being written.
+   */
+  std::deque<Snapshot> _queue;
+
+  /**
+   * The first error in the background, if any.
+   */
+  std::exception_ptr _error;
+
+#ifdef LIBMESH_HAVE_CXX11_THREAD
+  /**
+   * Guards everything above which the background thread uses.
+   */
+  mutable std::mutex _mutex;
+
+  /**
+   * Signals changes to the queue, in either direction.
+   */
+  std::condition_variable _changed;
+
+  bool _stop;
+
+  std::thread _thread;
+#endif
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_ASYNC_TIMESTEP_WRITER_H
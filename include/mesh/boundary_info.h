@@ -98,9 +98,30 @@ public:
    * individual id associations (an O(1) process) without checking to
    * see whether that is the last association with the id (an O(N)
    * process.
+   *
+   * Also, unless \p set_flat_id_lookup(false) was called, moves the
+   * boundary ids into compact, read-only lookup tables, which speed
+   * up boundary_ids() and has_boundary_id() and take much less
+   * memory than the id maps they replace.  The maps are rebuilt from
+   * the tables when the ids are next modified, or when anything
+   * reads the maps directly, e.g. through \p get_sideset_map().
    */
   void regenerate_id_sets ();
 
+  /**
+   * Sets whether \p regenerate_id_sets() moves the boundary ids into
+   * the compact lookup tables.  Turning the tables off rebuilds the
+   * id maps if needed, frees the tables, and keeps the ids in the
+   * maps from then on.  This is true by default.
+   */
+  void set_flat_id_lookup (bool use_flat_ids);
+
+  /**
+   * \returns Whether \p regenerate_id_sets() moves the boundary ids
+   * into the compact lookup tables.
+   */
+  bool flat_id_lookup () const { return _use_flat_ids; }
+
 
   /**
    * Generates \p boundary_mesh data structures corresponding to the
@@ -857,22 +878,31 @@ public:
   static const boundary_id_type invalid_id;
 
   /**
-   * \returns A const reference to the nodeset map.
+   * \returns A const reference to the nodeset map.  This rebuilds the
+   * map if \p regenerate_id_sets() had moved its ids into the compact
+   * lookup tables; it stays valid until the ids are next modified or
+   * regenerated.
    */
   const std::multimap<const Node *, boundary_id_type> & get_nodeset_map () const
-  { return _boundary_node_id; }
+  { this->_ensure_id_maps(); return _boundary_node_id; }
 
   /**
-   * \returns A const reference to the edgeset map.
+   * \returns A const reference to the edgeset map.  This rebuilds the
+   * map if \p regenerate_id_sets() had moved its ids into the compact
+   * lookup tables; it stays valid until the ids are next modified or
+   * regenerated.
    */
   const std::multimap<const Elem *, std::pair<unsigned short int, boundary_id_type>> & get_edgeset_map () const
-  { return _boundary_edge_id; }
+  { this->_ensure_id_maps(); return _boundary_edge_id; }
 
   /**
-   * \returns A const reference to the sideset map.
+   * \returns A const reference to the sideset map.  This rebuilds the
+   * map if \p regenerate_id_sets() had moved its ids into the compact
+   * lookup tables; it stays valid until the ids are next modified or
+   * regenerated.
    */
   const std::multimap<const Elem *, std::pair<unsigned short int, boundary_id_type>> & get_sideset_map() const
-  { return _boundary_side_id; }
+  { this->_ensure_id_maps(); return _boundary_side_id; }
 
 private:
 
@@ -888,6 +918,29 @@ private:
                       std::map<std::pair<dof_id_type, unsigned char>, dof_id_type> * side_id_map,
                       const std::set<subdomain_id_type> & subdomains_relative_to);
 
+  /**
+   * \returns The element whose stored ids apply to side \p side of \p
+   * elem: \p elem itself if it is a level-0 element, otherwise the
+   * ancestor it inherits that side's ids from, or nullptr if it
+   * inherits none.
+   */
+  const Elem * _side_ids_elem (const Elem * const elem,
+                               const unsigned short int side) const;
+
+  /**
+   * Rebuilds the id maps from the compact lookup tables, if \p
+   * regenerate_id_sets() had freed them.  This may be called by
+   * several threads at once.
+   */
+  void _ensure_id_maps () const;
+
+  /**
+   * Makes the id maps the only copy of the boundary ids again,
+   * rebuilding them if needed and freeing the compact lookup tables.
+   * This must be called before the maps are modified.
+   */
+  void _edit_id_maps ();
+
   /**
    * A pointer to the Mesh this boundary info pertains to.
    */
@@ -897,33 +950,61 @@ private:
    * Data structure that maps nodes in the mesh
    * to boundary ids.
    */
-  std::multimap<const Node *,
-                boundary_id_type> _boundary_node_id;
+  mutable std::multimap<const Node *,
+                        boundary_id_type> _boundary_node_id;
 
   /**
    * Data structure that maps edges of elements
    * to boundary ids. This is only relevant in 3D.
    */
-  std::multimap<const Elem *,
-                std::pair<unsigned short int, boundary_id_type>>
+  mutable std::multimap<const Elem *,
+                        std::pair<unsigned short int, boundary_id_type>>
   _boundary_edge_id;
 
   /**
    * Data structure that maps faces of shell elements
    * to boundary ids. This is only relevant for shell elements.
    */
-  std::multimap<const Elem *,
-                std::pair<unsigned short int, boundary_id_type>>
+  mutable std::multimap<const Elem *,
+                        std::pair<unsigned short int, boundary_id_type>>
   _boundary_shellface_id;
 
   /**
    * Data structure that maps sides of elements
    * to boundary ids.
    */
-  std::multimap<const Elem *,
-                std::pair<unsigned short int, boundary_id_type>>
+  mutable std::multimap<const Elem *,
+                        std::pair<unsigned short int, boundary_id_type>>
   _boundary_side_id;
 
+  /**
+   * Contiguous copies of the id maps, in the same order, built by \p
+   * regenerate_id_sets(), which then frees the maps.  While \p
+   * _flat_ids_valid, lookups binary search these instead of walking
+   * the multimap trees.  Any change to the ids rebuilds the maps and
+   * frees these, so the maps remain the only data that needs
+   * updating during mesh construction and modification.
+   */
+  std::vector<std::pair<const Elem *,
+                        std::pair<unsigned short int, boundary_id_type>>>
+  _flat_side_ids, _flat_edge_ids, _flat_shellface_ids;
+
+  std::vector<std::pair<const Node *, boundary_id_type>> _flat_node_ids;
+
+  bool _flat_ids_valid;
+
+  /**
+   * Whether the id maps hold the boundary ids; at least one of this
+   * and \p _flat_ids_valid is always true.
+   */
+  mutable bool _id_maps_valid;
+
+  /**
+   * Whether \p regenerate_id_sets() moves the ids into the compact
+   * lookup tables.
+   */
+  bool _use_flat_ids;
+
   /**
    * A collection of user-specified boundary ids for sides, edges, nodes,
    * and shell faces.
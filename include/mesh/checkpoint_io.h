@@ -98,6 +98,17 @@ public:
    * running on several processors, input_name should simply be the name of the mesh split
    * directory without the "-split[n]" suffix.  The number of splits will be determined
    * automatically by the number of processes being used for the mesh at the time of reading.
+   *
+   * If input_name is a single shared checkpoint file (see \p shared_file()) it is read
+   * collectively, each processor reading only the byte ranges of the splits it needs.
+   *
+   * A distributed mesh may be read from a checkpoint with a different number of splits than
+   * it has processors; select which with \p current_n_processors().  Each processor then
+   * reads and owns a contiguous block of splits of roughly equal total size, and the result
+   * is partitioned along a space filling curve and redistributed in parallel, without ever
+   * serializing the mesh.  The next \p prepare_for_use() keeps that partitioning rather than
+   * partitioning the mesh again.  Without libHilbert the curve is replaced by element id
+   * order.
    */
   virtual void read (const std::string & input_name) override;
 
@@ -113,6 +124,9 @@ public:
    *     cp->write("foo.cpr");
    *
    * would create a directory named "foo.cpr-split42".
+   *
+   * If \p shared_file() is set, the header and all splits are
+   * instead written collectively into the single file \p name.
    */
   virtual void write (const std::string & name) override;
 
@@ -136,6 +150,8 @@ public:
    *     CheckpointIO::cleanup(your_mesh, your_mesh.comm().size());
    *
    * Other remaining checkpoint split configurations for the mesh are left unmodified.
+   *
+   * A single shared checkpoint file is removed by processor 0 only.
    */
   static void cleanup(const std::string & input_name, processor_id_type n_procs);
 
@@ -151,6 +167,24 @@ public:
   bool   parallel() const { return _parallel; }
   bool & parallel()       { return _parallel; }
 
+  /**
+   * Get/Set the flag indicating if we should write a single shared
+   * file rather than a directory with a file per split.
+   *
+   * The shared file holds a small preamble, an index of the byte
+   * offset of each split, the header, and then the splits, each
+   * stored exactly as it would be in its own file.  It is written
+   * with MPI-IO, each processor writing its splits at their offsets,
+   * so the file system sees one file however many splits there are.
+   * Each processor keeps its encoded splits in memory until they are
+   * written.
+   *
+   * Shared files are recognized automatically when reading, and
+   * record whether they are binary.
+   */
+  bool   shared_file() const { return _shared_file; }
+  bool & shared_file()       { return _shared_file; }
+
   /**
    * Get/Set the version string.
    */
@@ -243,12 +277,27 @@ private:
   // Read Implementation
 
   /**
-   * Read header data on processor 0, then broadcast.  Returns the
-   * number of processors for which parallel non-header files have
-   * been written, or 0 if files were written in serial.
+   * Read the version and integer size from the header \p io on
+   * processor 0, then the rest of the header with the matching
+   * integer type.  \p io is ignored on other processors.  Returns the
+   * number of splits, which is 1 if the files were written in serial,
+   * and sets \p data_size everywhere.
+   */
+  processor_id_type read_header(Xdr * io, header_id_type & data_size);
+
+  /**
+   * Read header data, after the version and integer size, on
+   * processor 0, then broadcast.  Returns the number of processors
+   * for which parallel non-header files have been written, or 0 if
+   * files were written in serial.
    */
   template <typename file_id_type>
-  file_id_type read_header(const std::string & name);
+  file_id_type read_header(Xdr * io, const std::string & input_version);
+
+  /**
+   * Read a non-header file written with integers of \p data_size bytes
+   */
+  void read_subfile(Xdr & io, header_id_type data_size, bool expect_all_remote);
 
   /**
    * Read a non-header file
@@ -256,6 +305,24 @@ private:
   template <typename file_id_type>
   void read_subfile(Xdr & io, bool expect_all_remote);
 
+  /**
+   * Read the single shared file \p input_name collectively.  Returns
+   * the number of splits in it.
+   */
+  processor_id_type read_shared_file(const std::string & input_name);
+
+  /**
+   * Sets the processor reading each split, which on a distributed
+   * mesh also becomes the owner of the objects of that split.
+   */
+  void set_split_readers(const std::vector<processor_id_type> & readers);
+
+  /**
+   * \returns The processor to own an object written with processor id
+   * \p pid
+   */
+  processor_id_type read_pid(largest_id_type pid) const;
+
   /**
    * Read subdomain name information
    */
@@ -326,6 +393,7 @@ private:
 
   bool _binary;
   bool _parallel;
+  bool _shared_file;
   std::string _version;
 
   // The processor ids to write
@@ -333,6 +401,9 @@ private:
 
   // The largest processor id to write
   processor_id_type _my_n_processors;
+
+  // The processor reading each split, while reading a distributed mesh
+  std::vector<processor_id_type> _split_readers;
 };
 
 
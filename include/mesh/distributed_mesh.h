@@ -21,6 +21,7 @@
 #define LIBMESH_DISTRIBUTED_MESH_H
 
 // Local Includes
+#include "libmesh/dense_mapvector.h"
 #include "libmesh/mapvector.h"
 #include "libmesh/unstructured_mesh.h"
 #include "libmesh/auto_ptr.h" // libmesh_make_unique
@@ -51,6 +52,20 @@ class DistributedMesh : public UnstructuredMesh
 {
 public:
 
+  /**
+   * The container type for our nodes and elements.  With
+   * --enable-dense-mesh-containers this is a \p dense_mapvector,
+   * which gives constant time lookups of local objects, otherwise a
+   * \p mapvector.
+   */
+#ifdef LIBMESH_ENABLE_DENSE_MESH_CONTAINERS
+  template <typename T>
+  using dofobject_container = dense_mapvector<T *, dof_id_type>;
+#else
+  template <typename T>
+  using dofobject_container = mapvector<T *, dof_id_type>;
+#endif
+
   /**
    * Constructor.  Takes \p dim, the dimension of the mesh.
    * The mesh dimension can be changed (and may automatically be
@@ -116,6 +131,23 @@ public:
    */
   virtual void redistribute () override;
 
+  /**
+   * If \p delta is true, later calls to redistribute() will only
+   * send each processor the nodes and elements it does not already
+   * store; see MeshCommunication::delta_redistribute().  This makes
+   * repartitioning after every adaptive step affordable when each
+   * repartitioning moves few elements.  The --delta-redistribution
+   * command line option sets this by default.
+   */
+  void delta_redistribution (bool delta) { _delta_redistribution = delta; }
+  bool delta_redistribution () const { return _delta_redistribution; }
+
+  /**
+   * \returns The number of bytes of packed nodes and elements this
+   * processor sent during the last delta redistribution.
+   */
+  std::size_t n_redistributed_bytes () const { return _n_redistributed_bytes; }
+
   /**
    * Recalculate cached data after elements and nodes have been
    * repartitioned.
@@ -157,7 +189,7 @@ public:
    * Calls libmesh_assert() on each possible failure in that container.
    */
   template <typename T>
-  void libmesh_assert_valid_parallel_object_ids(const mapvector<T *,dof_id_type> &) const;
+  void libmesh_assert_valid_parallel_object_ids(const dofobject_container<T> &) const;
 
   /**
    * Verify id and processor_id consistency of our elements and
@@ -185,7 +217,7 @@ public:
    * \returns The smallest globally unused id for that container.
    */
   template <typename T>
-  dof_id_type renumber_dof_objects (mapvector<T *,dof_id_type> &);
+  dof_id_type renumber_dof_objects (dofobject_container<T> &);
 
   /**
    * Remove nullptr elements from arrays.
@@ -576,12 +608,12 @@ protected:
   /**
    * The vertices (spatial coordinates) of the mesh.
    */
-  mapvector<Node *, dof_id_type> _nodes;
+  dofobject_container<Node> _nodes;
 
   /**
    * The elements in the mesh.
    */
-  mapvector<Elem *, dof_id_type> _elements;
+  dofobject_container<Elem> _elements;
 
   /**
    * A boolean remembering whether we're serialized or not
@@ -620,21 +652,30 @@ protected:
    */
   std::set<Elem *> _extra_ghost_elems;
 
+  /**
+   * Whether redistribute() should only send objects their new owners
+   * and ghosters do not already have.
+   */
+  bool _delta_redistribution;
+
+  /**
+   * The bytes sent by this processor in the last delta redistribution.
+   */
+  std::size_t _n_redistributed_bytes;
+
 private:
 
   /**
-   * Typedefs for the container implementation.  In this case,
-   * it's just a std::vector<Elem *>.
+   * Typedefs for the container implementation.
    */
-  typedef mapvector<Elem *, dof_id_type>::veclike_iterator             elem_iterator_imp;
-  typedef mapvector<Elem *, dof_id_type>::const_veclike_iterator const_elem_iterator_imp;
+  typedef dofobject_container<Elem>::veclike_iterator             elem_iterator_imp;
+  typedef dofobject_container<Elem>::const_veclike_iterator const_elem_iterator_imp;
 
   /**
-   * Typedefs for the container implementation.  In this case,
-   * it's just a std::vector<Node *>.
+   * Typedefs for the container implementation.
    */
-  typedef mapvector<Node *, dof_id_type>::veclike_iterator             node_iterator_imp;
-  typedef mapvector<Node *, dof_id_type>::const_veclike_iterator const_node_iterator_imp;
+  typedef dofobject_container<Node>::veclike_iterator             node_iterator_imp;
+  typedef dofobject_container<Node>::const_veclike_iterator const_node_iterator_imp;
 };
 
 
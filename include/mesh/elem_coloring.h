@@ -0,0 +1,111 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2021 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_ELEM_COLORING_H
+#define LIBMESH_ELEM_COLORING_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/elem_range.h"
+
+// C++ includes
+#include <memory>
+#include <vector>
+
+namespace libMesh
+{
+
+// forward declarations
+class Elem;
+class MeshBase;
+
+/**
+ * This class partitions the active local elements of a mesh into
+ * "colors", such that no two elements of the same color share a
+ * node.  Since nodal, edge and face degrees of freedom all live on
+ * nodes, elements of one color have disjoint sets of degrees of
+ * freedom, and threads working on different elements of one color
+ * can add into global data structures without locking, as long as
+ * the underlying data structures allow concurrent writes to
+ * different entries.  Elements coupled through SCALAR variables or
+ * through non-trivial constraint rows are not separated by this
+ * coloring.
+ *
+ * The coloring is computed greedily, visiting the elements in mesh
+ * order and giving each the smallest color not used by any
+ * already-colored element sharing one of its nodes.
+ *
+ * Users will normally get the coloring from \p
+ * MeshBase::elem_coloring(), which caches it until an element is
+ * added or deleted, or the mesh is next prepared for use, partitioned
+ * or cleared.
+ *
+ * \date 2021
+ * \brief Greedy node-sharing coloring of the active local elements.
+ */
+class ElemColoring
+{
+public:
+
+  /**
+   * Constructor.  Colors the active local elements of \p mesh.
+   */
+  explicit
+  ElemColoring (const MeshBase & mesh);
+
+  /**
+   * The ranges refer to our element vectors, so we can be neither
+   * copied nor moved.
+   */
+  ElemColoring (const ElemColoring &) = delete;
+  ElemColoring & operator= (const ElemColoring &) = delete;
+
+  /**
+   * \returns The number of colors used.
+   */
+  unsigned int n_colors () const
+  { return cast_int<unsigned int>(_elems.size()); }
+
+  /**
+   * \returns The active local elements of color \p c.
+   */
+  const std::vector<const Elem *> & elements (unsigned int c) const;
+
+  /**
+   * \returns A range over the active local elements of color \p c,
+   * suitable for \p Threads::parallel_for().
+   */
+  const ConstElemRange & range (unsigned int c) const;
+
+private:
+
+  /**
+   * The elements of each color.
+   */
+  std::vector<std::vector<const Elem *>> _elems;
+
+  /**
+   * A range over each of the \p _elems vectors.
+   */
+  std::vector<std::unique_ptr<ConstElemRange>> _ranges;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_ELEM_COLORING_H
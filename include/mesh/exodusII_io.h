@@ -203,7 +203,10 @@ public:
                                      const std::set<std::string> * system_names=nullptr);
 
   /**
-   * Write out element solution.
+   * Write out element solution.  Once the elements are in the file,
+   * e.g. after the first time step, each variable is gathered to
+   * processor 0 and written in turn, as by the parallel version of
+   * write_nodal_data(), so the mesh isn't serialized.
    */
   void write_element_data (const EquationSystems & es);
 
@@ -248,6 +251,23 @@ public:
                                  const std::vector<Number> &,
                                  const std::vector<std::string> &) override;
 
+  /**
+   * Write out a nodal solution from a parallel vector.  Once the
+   * nodes are in the file, e.g. after the first time step, each
+   * variable is gathered to processor 0 straight from the processors
+   * owning it and written in turn, so neither the mesh nor the whole
+   * solution needs to be serialized.  Otherwise the vector is
+   * localized and written by the serial version.
+   *
+   * \note Processor 0 still writes every value, and holds one whole
+   * variable at a time to do so: the ExodusII and NetCDF libraries
+   * we build have no parallel I/O with which each processor could
+   * write its own part.  Use Nemesis_IO for fully parallel output.
+   */
+  virtual void write_nodal_data (const std::string &,
+                                 const NumericVector<Number> &,
+                                 const std::vector<std::string> &) override;
+
   /**
    * Write out a discontinuous nodal solution.
    */
@@ -280,6 +300,48 @@ public:
                        const Real time,
                        const std::set<std::string> * system_names=nullptr);
 
+  /**
+   * Writes time step \p timestep at \p time from \p soln, a nodal
+   * solution indexed like the one built on processor 0 by
+   * EquationSystems::build_solution_vector(), with variables \p
+   * names, to the file \p fname this object is already writing.
+   *
+   * Unlike write_timestep() this is not collective and never uses
+   * the mesh: only processor 0 does anything, using the node order
+   * stored when the mesh was written.  It is therefore safe to call
+   * from a background thread while the mesh and solution move on;
+   * see AsyncTimestepWriter.  Like every other call into the Exodus
+   * library, it holds an ExodusII_IO_Helper::IOLock while it writes.
+   */
+  void write_timestep_snapshot (const std::string & fname,
+                                const std::vector<Number> & soln,
+                                const std::vector<std::string> & names,
+                                const int timestep,
+                                const Real time);
+
+  /**
+   * Gathers to processor 0 the variables of \p parallel_soln, laid
+   * out like the vector from
+   * EquationSystems::build_parallel_solution_vector() with variables
+   * \p names, which this object would write.  They end up in \p soln,
+   * node-major like the vector from
+   * EquationSystems::build_solution_vector(), with their names in \p
+   * soln_names, ready for write_timestep_snapshot().  Variables which
+   * aren't output are never sent.  Collective.
+   */
+  void gather_output_nodal_data (const NumericVector<Number> & parallel_soln,
+                                 const std::vector<std::string> & names,
+                                 std::vector<Number> & soln,
+                                 std::vector<std::string> & soln_names) const;
+
+  /**
+   * \returns \p true, on every processor, if the nodes of a
+   * continuous mesh are already in the file we are writing, so that
+   * nodal values can be written without serializing the mesh.
+   * Collective.
+   */
+  bool continuous_nodes_written () const;
+
   /**
    * The Exodus format can also store values on sidesets. This can be
    * thought of as an alternative to defining an elemental variable
@@ -438,6 +500,25 @@ public:
                                const std::vector<std::string> & names,
                                bool continuous=true);
 
+  /**
+   * Writes the CONSTANT MONOMIAL variables of \p es in \p names, or
+   * all of them if it is empty, to a file whose elements are already
+   * written, without the mesh.  \p names is updated as by
+   * EquationSystems::build_parallel_elemental_solution_vector().
+   */
+  void write_element_data_parallel (const EquationSystems & es,
+                                    std::vector<std::string> & names);
+
+  /**
+   * Writes variable \p var of the \p num_vars in the node-major
+   * solution \p soln, indexed by node id, as the output variable at
+   * \p variable_name_position.  Processor 0 only.
+   */
+  void write_nodal_values_by_id (const std::vector<Number> & soln,
+                                 unsigned int num_vars,
+                                 unsigned int var,
+                                 unsigned int variable_name_position);
+
 private:
   /**
    * Only attempt to instantiate an ExodusII helper class
@@ -463,6 +544,11 @@ private:
    * rather than created from scratch when writing.
    */
   bool _append;
+
+  /**
+   * The mesh's \p modification_count() when we wrote its nodes.
+   */
+  unsigned long _nodes_modification_count;
 #endif
 
   /**
@@ -34,6 +34,9 @@
 #include <string>
 #include <vector>
 #include <map>
+#ifdef LIBMESH_HAVE_CXX11_THREAD
+# include <mutex>
+#endif
 
 // Macros to simplify checking Exodus error codes
 #define EX_CHECK_ERR(code, msg)                 \
@@ -109,6 +112,27 @@ public:
   ExodusII_IO_Helper & operator= (const ExodusII_IO_Helper &) = delete;
   ExodusII_IO_Helper & operator= (ExodusII_IO_Helper &&) = delete;
 
+  /**
+   * Holds the lock serializing all calls into the ExodusII, Nemesis,
+   * NetCDF and HDF5 libraries, none of which is thread-safe, for as
+   * long as it exists.  Every ExodusII_IO and Nemesis_IO function
+   * which reads or writes a file takes one, so an
+   * AsyncTimestepWriter thread can't interleave its calls with the
+   * main thread's.  Code using an ExodusII_IO_Helper directly while
+   * such a thread may be running must take one too.  The lock is
+   * recursive, so those functions may call each other.
+   */
+  class IOLock
+  {
+  public:
+    IOLock ();
+
+  private:
+#ifdef LIBMESH_HAVE_CXX11_THREAD
+    std::lock_guard<std::recursive_mutex> _lock;
+#endif
+  };
+
   /**
    * \returns The current element type.
    *
@@ -412,6 +436,20 @@ public:
    const std::vector<std::string> & derived_var_names,
    const std::map<subdomain_id_type, std::vector<std::string>> & subdomain_to_var_names);
 
+  /**
+   * Writes \p values, one per element indexed by libMesh element id,
+   * to the element variable \p var_id (1-based), on the blocks of
+   * the subdomains in \p active_subdomains, or of all subdomains if
+   * it is empty.  Unlike write_element_values() this doesn't need
+   * the mesh: the elements of each block are those stored by
+   * write_elements(), so it only works on files this object wrote.
+   */
+  void write_element_values_by_id
+  (int var_id,
+   const std::vector<Real> & values,
+   int timestep,
+   const std::set<subdomain_id_type> & active_subdomains);
+
   /**
    * Writes the vector of values to a nodal variable.
    */
@@ -581,6 +619,10 @@ public:
   // Vector of element block identification numbers
   std::vector<int> block_ids;
 
+  // Number of elements in each element block written, in the order
+  // of block_ids
+  std::vector<int> num_elem_per_blk;
+
   // Vector of edge block identification numbers
   std::vector<int> edge_block_ids;
 
@@ -68,8 +68,14 @@ public:
   GmshIO (const MeshBase & mesh);
 
   /**
-   * Reads in a mesh in the Gmsh *.msh format from the ASCII file
-   * given by name.
+   * Reads in a mesh in the Gmsh *.msh format from the file given by
+   * name.  Files of version 4.1 may be ASCII or binary, in either
+   * byte order; each block of nodes or elements in a binary file is
+   * read at once.
+   *
+   * \note Only processor 0 reads the file, which MeshBase::read()
+   * then broadcasts.  Partitioned files are read whole: processors
+   * don't read their own entity blocks in parallel.
    *
    * \note The user is responsible for calling Mesh::prepare_for_use()
    * after reading the mesh and before using it.
@@ -84,7 +90,8 @@ public:
 
   /**
    * This method implements writing a mesh to a specified file
-   * in the Gmsh *.msh format.
+   * in the Gmsh *.msh format: version 4.1 binary if binary() is
+   * set, and version 2.0 ASCII otherwise.
    */
   virtual void write (const std::string & name) override;
 
@@ -103,14 +110,12 @@ public:
                                  const std::vector<std::string> &) override;
 
   /**
-   * Flag indicating whether or not to write a binary file.  While binary
-   * files may end up being smaller than equivalent ASCII files, they will
-   * almost certainly take longer to write.  The reason for this is that
-   * the ostream::write() function which is used to write "binary" data to
-   * streams, only takes a pointer to char as its first argument.  This means
-   * if you want to write anything other than a buffer of chars, you first
-   * have to use a strange memcpy hack to get the data into the desired format.
-   * See the templated to_binary_stream() function below.
+   * Flag indicating whether or not to write a binary file.  Binary
+   * *.msh files are written in version 4.1 of the format, a block of
+   * nodes or elements at a time, and are much faster to write and
+   * read than ASCII files.  Binary *.pos files, on the other hand, are
+   * written a value at a time, and may well take longer to write
+   * than ASCII ones.
    */
   bool & binary ();
 
@@ -134,6 +139,14 @@ private:
    */
   void write_mesh (std::ostream & out);
 
+  /**
+   * This method implements writing a mesh to a specified file as a
+   * binary *.msh file of version 4.1.  Each subdomain of elements
+   * and each boundary id of sides is written as an entity whose
+   * physical tag is that id.
+   */
+  void write_mesh_binary (std::ostream & out);
+
   /**
    * This method implements writing a mesh with nodal data to a specified file
    * where the nodal data and variable names are optionally provided.  This
@@ -50,6 +50,7 @@ namespace libMesh
 
 // forward declarations
 class Elem;
+class ElemColoring;
 class GhostingFunctor;
 class Node;
 class Point;
@@ -165,6 +166,26 @@ public:
   void set_isnt_prepared()
   { _is_prepared = false; }
 
+  /**
+   * \returns A counter which changes whenever a node or element is
+   * added, deleted or renumbered, the mesh is prepared for use,
+   * partitioned or cleared, or its nodes are moved by the
+   * MeshTools::Modification functions or a MeshSmoother.  Output
+   * classes compare it between time steps to tell whether the node
+   * order they last wrote is still valid.  Code which moves nodes
+   * itself should call \p mark_modified() afterwards.  Each
+   * processor counts its own changes, so the count need not be the
+   * same on every processor.
+   */
+  unsigned long modification_count () const
+  { return _modification_count; }
+
+  /**
+   * Changes the \p modification_count().
+   */
+  void mark_modified ()
+  { ++_modification_count; }
+
   /**
    * \returns \p true if all elements and nodes of the mesh
    * exist on the current processor, \p false otherwise
@@ -1117,6 +1138,32 @@ public:
 
   bool skip_partitioning() const { return _skip_all_partitioning; }
 
+  /**
+   * Tells the next prepare_for_use() not to partition the mesh, as
+   * though skip_partitioning() were set for that call only.  A reader
+   * which has just partitioned and redistributed the mesh it read
+   * uses this to avoid doing so twice.
+   */
+  void skip_next_partitioning() { _skip_next_partitioning = true; }
+
+  /**
+   * If a nonzero \p approx_buffer_size is passed in then
+   * MeshCommunication::broadcast() streams this mesh from processor 0
+   * down a tree of processors in buffers of about that many packed
+   * entries, rather than broadcasting all the nodes, then each level
+   * of elements, in one piece.  This keeps the transient memory use
+   * of the broadcast independent of the mesh size.
+   *
+   * Zero turns this off.  That is the default, unless the
+   * --pipelined-mesh-broadcast command line option is given, in which
+   * case the default is the --mesh-broadcast-buffer-size option, or
+   * one million.
+   */
+  void set_broadcast_buffer_size(std::size_t approx_buffer_size)
+  { _broadcast_buffer_size = approx_buffer_size; }
+
+  std::size_t broadcast_buffer_size() const { return _broadcast_buffer_size; }
+
   /**
    * Adds a functor which can specify ghosting requirements for use on
    * distributed meshes.  Multiple ghosting functors can be added; any
@@ -1334,6 +1381,68 @@ public:
    */
   void clear_point_locator ();
 
+  /**
+   * \returns A coloring of the active local elements, such that no
+   * two elements of one color share a node, constructing it first if
+   * necessary.  The coloring is cached until an element is added or
+   * deleted, or the mesh is next prepared for use, partitioned or
+   * cleared.  This should not be
+   * used in threaded code unless the coloring has already been
+   * constructed.
+   */
+  const ElemColoring & elem_coloring () const;
+
+  /**
+   * Releases the current \p ElemColoring object.
+   */
+  void clear_elem_coloring ();
+
+  /**
+   * \returns The active local elements, in the order in which \p
+   * active_local_element_ptr_range() visits them, building the list
+   * first if necessary.  Looping over this vector, or over a \p
+   * ConstElemRange built from it, costs a pointer increment per
+   * element rather than the virtual calls and predicate tests of the
+   * filtered mesh iterators.  The cached element lists are dropped
+   * when elements are added or deleted, and when the mesh is next
+   * prepared for use, partitioned, redistributed or cleared.  Code
+   * which changes the subdomain ids, processor ids or refinement
+   * state of elements directly, rather than through those methods or
+   * \p MeshTools::Modification::change_subdomain_id(), must call \p
+   * clear_cached_elem_lists() itself.  This should not be used in
+   * threaded code unless the list has already been built.
+   */
+  const std::vector<const Elem *> & cached_active_local_elements () const;
+
+  /**
+   * \returns The active local elements with subdomain id \p sid.
+   * See \p cached_active_local_elements().
+   */
+  const std::vector<const Elem *> &
+  cached_active_local_subdomain_elements (subdomain_id_type sid) const;
+
+  /**
+   * \returns The active semilocal elements.  See \p
+   * cached_active_local_elements().
+   */
+  const std::vector<const Elem *> & cached_active_semilocal_elements () const;
+
+  /**
+   * \returns The sides of active local elements with boundary id \p
+   * bid, as (element, side) pairs, in the same order as \p
+   * cached_active_local_elements().  Sides of refined elements are
+   * included when an ancestor's side has the id.  These lists are
+   * also dropped whenever the \p BoundaryInfo side ids change.  See
+   * \p cached_active_local_elements().
+   */
+  const std::vector<std::pair<const Elem *, unsigned short int>> &
+  cached_active_local_boundary_sides (boundary_id_type bid) const;
+
+  /**
+   * Releases the cached element and boundary side lists.
+   */
+  void clear_cached_elem_lists ();
+
   /**
    * In the point locator, do we count lower dimensional elements
    * when we refine point locator regions? This is relevant in
@@ -1813,12 +1922,49 @@ protected:
    */
   mutable std::unique_ptr<PointLocatorBase> _point_locator;
 
+  /**
+   * A coloring of the active local elements, for threaded loops.
+   * This will not actually be built unless needed, and is mutable
+   * for the same reasons as \p _point_locator.
+   */
+  mutable std::unique_ptr<ElemColoring> _elem_coloring;
+
+  /**
+   * Cached lists of the active local elements, in total and by
+   * subdomain, and whether they have been built.  These are mutable
+   * for the same reasons as \p _point_locator.
+   */
+  mutable bool _cached_local_elem_lists_built;
+  mutable std::vector<const Elem *> _cached_active_local_elems;
+  mutable std::map<subdomain_id_type, std::vector<const Elem *>>
+    _cached_active_local_subdomain_elems;
+
+  /**
+   * Cached list of the active semilocal elements, and whether it has
+   * been built.
+   */
+  mutable bool _cached_semilocal_elem_list_built;
+  mutable std::vector<const Elem *> _cached_active_semilocal_elems;
+
+  /**
+   * Cached lists of the boundary sides of the active local elements,
+   * by boundary id, and whether they have been built.
+   */
+  mutable bool _cached_boundary_side_lists_built;
+  mutable std::map<boundary_id_type, std::vector<std::pair<const Elem *, unsigned short int>>>
+    _cached_active_local_boundary_sides;
+
   /**
    * Do we count lower dimensional elements in point locator refinement?
    * This is relevant in tree-based point locators, for example.
    */
   bool _count_lower_dim_elems_in_point_locator;
 
+  /**
+   * The value of \p modification_count().
+   */
+  unsigned long _modification_count;
+
   /**
    * A partitioner to use at each prepare_for_use().
    *
@@ -1845,6 +1991,12 @@ protected:
    */
   bool _skip_all_partitioning;
 
+  /**
+   * If this is true then the next prepare_for_use() should not
+   * partition.
+   */
+  bool _skip_next_partitioning;
+
   /**
    * If this is true then renumbering will be kept to a minimum.
    *
@@ -1865,6 +2017,13 @@ protected:
    */
   bool _allow_remote_element_removal;
 
+  /**
+   * The approximate size of the buffers in which
+   * MeshCommunication::broadcast() streams this mesh, or zero to
+   * broadcast it in one piece.
+   */
+  std::size_t _broadcast_buffer_size;
+
   /**
    * This structure maintains the mapping of named blocks
    * for file formats that support named blocks.  Currently
@@ -1996,6 +2155,12 @@ protected:
    * it can directly broadcast *_integer_names
    */
   friend class MeshCommunication;
+
+  /**
+   * Make the \p MeshSerializer class a friend so that serializing
+   * the mesh for output doesn't count as modifying it
+   */
+  friend class MeshSerializer;
 };
 
 
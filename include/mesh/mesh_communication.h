@@ -81,6 +81,12 @@ public:
    * processor 0) and broadcasts it to all the other processors.
    * It also broadcasts any boundary information the mesh has
    * associated with it.
+   *
+   * If the mesh has a nonzero MeshBase::broadcast_buffer_size(),
+   * nodes and elements are instead streamed down a tree of processors
+   * in buffers of about that many entries, each processor unpacking
+   * one buffer while forwarding the next.  This keeps the transient
+   * memory use independent of the mesh size.
    */
   void broadcast (MeshBase &) const;
 
@@ -101,6 +107,24 @@ public:
   void redistribute (DistributedMesh & mesh,
                      bool newly_coarsened_only = false) const;
 
+  /**
+   * Redistributes the elements of a parallel distributed mesh like
+   * \p redistribute() does, but without sending any processor the
+   * nodes or elements it already stores.  Each processor instead
+   * offers the ids of the objects \p redistribute() would send, and
+   * each recipient requests only the ones it lacks, each from a
+   * single sender.  When a repartitioning moves few elements, e.g.
+   * during dynamic load balancing, this sends far less data.
+   *
+   * Copies of nodes and elements which a processor already stores
+   * are assumed to be consistent with the sender's, as they are on a
+   * prepared mesh.
+   *
+   * \returns The number of bytes of packed nodes and elements this
+   * processor sent.
+   */
+  std::size_t delta_redistribute (DistributedMesh & mesh) const;
+
   /**
    *
    */
@@ -49,6 +49,12 @@ public:
 private:
   MeshBase & _mesh;
   bool reparallelize;
+
+  /**
+   * The mesh's modification count before we serialized it, which we
+   * restore since the mesh itself hasn't changed.
+   */
+  unsigned long _modification_count;
 };
 
 } // namespace libMesh
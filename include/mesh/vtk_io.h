@@ -36,6 +36,10 @@
 // C++ includes
 #include <cstddef>
 #include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
 
 // Forward declarations
 class vtkUnstructuredGrid;
@@ -112,6 +116,23 @@ public:
    */
   virtual void write (const std::string &) override;
 
+  /**
+   * Writes the solution of \p es at \p time as time step \p timestep
+   * of the series \p fname, a ParaView .pvd collection.  Each step
+   * goes to its own .pvtu file, named after \p fname and \p
+   * timestep, and processor 0 rewrites the collection to list every
+   * step this object has written to it.
+   *
+   * VTK's XML formats have no way for one file to refer to the
+   * geometry in another, so every step file holds the full points
+   * and cells.
+   */
+  void write_timestep (const std::string & fname,
+                       const EquationSystems & es,
+                       const int timestep,
+                       const Real time,
+                       const std::set<std::string> * system_names=nullptr);
+
 #ifdef LIBMESH_HAVE_VTK
 
   /**
@@ -220,6 +241,13 @@ private:
   static ElementMaps build_element_maps();
 
 #endif
+
+  /**
+   * The .pvd collection being written by write_timestep(), and the
+   * time and file name of each step in it so far.
+   */
+  std::string _pvd_name;
+  std::vector<std::pair<Real, std::string>> _pvd_steps;
 };
 
 
@@ -109,6 +109,17 @@ public:
   bool   legacy() const { return _legacy; }
   bool & legacy()       { return _legacy; }
 
+  /**
+   * Get/Set the flag indicating if binary files should be read by
+   * mapping them into memory on every processor, each of which then
+   * decodes the whole file itself, since the serial reader builds
+   * every element and node everywhere.  Otherwise processor 0 reads
+   * the file and broadcasts it.  Off by default; it pays off when the
+   * file is on a filesystem every processor can read quickly.
+   */
+  bool   mapped_read() const { return _mapped_read; }
+  bool & mapped_read()       { return _mapped_read; }
+
   /**
    * Report whether we should write parallel files.
    */
@@ -332,8 +343,23 @@ private:
                      const dof_id_type parent_id  = DofObject::invalid_id,
                      const dof_id_type parent_pid = DofObject::invalid_id) const;
 
+  /**
+   * \returns \p true if this processor reads the file being read
+   * itself, rather than getting its contents from processor 0.
+   */
+  bool reads_file () const;
+
+  /**
+   * Broadcasts \p data read on processor 0, unless every processor
+   * is reading the file itself.
+   */
+  template <typename T>
+  void broadcast_read (T & data) const;
+
   bool _binary;
   bool _legacy;
+  bool _mapped_read;
+  bool _read_everywhere;
   bool _write_serial;
   bool _write_parallel;
   bool _write_unique_id;
@@ -68,10 +68,26 @@ namespace libMesh
 
 // Forward Declarations
 template <typename T> class DenseMatrix;
+namespace SparsityPattern {
+  class CSRGraph;
+}
 
+/**
+ * The PETSc storage formats supported by \p PetscMatrix.  \p BAIJ
+ * and \p SBAIJ store dense blocks of the \p DofMap::block_size()
+ * DoFs of each node, which saves index storage and speeds up
+ * matrix-vector products for systems whose variables all share one
+ * variable group; \p SBAIJ additionally stores only the upper
+ * triangle of a symmetric matrix, so \p PetscMatrix methods which
+ * read whole rows of it are not supported.  Both require libMesh to
+ * be configured with --enable-blocked-storage, and their blocks are
+ * only exact when \p DofMap::set_blocked_sparsity() is set.
+ */
 enum PetscMatrixType : int {
                  AIJ=0,
-                 HYPRE};
+                 HYPRE,
+                 BAIJ,
+                 SBAIJ};
 
 
 /**
@@ -348,6 +364,18 @@ private:
 
   PetscMatrixType _mat_type;
 
+#ifdef LIBMESH_ENABLE_BLOCKED_STORAGE
+  /**
+   * Sets the \p BAIJ or \p SBAIJ type of \p _mat and preallocates
+   * it, from the exact block sparsity \p b_csr if that is given, or
+   * else from the per-block-row counts \p b_n_nz and \p b_n_oz.
+   */
+  void init_blocked (const numeric_index_type blocksize,
+                     const std::vector<numeric_index_type> & b_n_nz,
+                     const std::vector<numeric_index_type> & b_n_oz,
+                     const SparsityPattern::CSRGraph * b_csr = nullptr);
+#endif
+
 #ifdef LIBMESH_HAVE_CXX11_THREAD
   mutable std::mutex _petsc_matrix_mutex;
 #else
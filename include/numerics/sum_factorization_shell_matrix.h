@@ -0,0 +1,187 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2021 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_SUM_FACTORIZATION_SHELL_MATRIX_H
+#define LIBMESH_SUM_FACTORIZATION_SHELL_MATRIX_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/shell_matrix.h"
+
+// C++ includes
+#include <memory>
+#include <vector>
+
+namespace libMesh
+{
+
+// forward declarations
+class System;
+
+/**
+ * This class applies the operator of the bilinear form
+ *
+ * \f[ a(u,v) = \int_\Omega \kappa \nabla u \cdot \nabla v + \sigma u v \f]
+ *
+ * for the Lagrange variable of a single variable \p System without
+ * ever assembling it.  The element actions are evaluated by sum
+ * factorization: on tensor product elements the shape functions are
+ * products of one dimensional shape functions, so interpolating to
+ * and integrating over a tensor product Gauss rule can be done one
+ * direction at a time, at a cost of O(p^(d+1)) per element rather
+ * than the O(p^(2d)) of a dense element matrix.
+ *
+ * The supported elements are EDGE2, QUAD4 and HEX8 for FIRST order
+ * variables, EDGE3, QUAD9 and HEX27 for SECOND order variables, and
+ * EDGE4 for THIRD order variables in one dimension.  Serendipity
+ * elements (QUAD8, HEX20) are not tensor products and are rejected.
+ *
+ * Only the geometric factors at the quadrature points, which are
+ * computed by \p init(), and the element dof indices are stored.
+ * Rows of constrained dofs act as the identity, and the remaining
+ * rows see the constrained operator \f$ C^T A C \f$, consistent
+ * with \p DofMap::constrain_element_matrix().
+ *
+ * The operator provides its diagonal, so it can be attached to a \p
+ * LinearImplicitSystem with \p attach_shell_matrix() and solved with
+ * a Jacobi preconditioned Krylov method, e.g. with \p -pc_type
+ * jacobi.  Adding the system matrix with \p MatrixBuildType::DIAGONAL
+ * before initializing the \p EquationSystems avoids allocating a
+ * sparse matrix altogether.
+ *
+ * \date 2021
+ * \brief Matrix-free diffusion-reaction operator using sum factorization.
+ */
+template <typename T>
+class SumFactorizationShellMatrix : public ShellMatrix<T>
+{
+public:
+  /**
+   * Constructor; the operator acts on the only variable of \p sys,
+   * which \p init() checks.
+   */
+  SumFactorizationShellMatrix (const System & sys);
+
+  /**
+   * Destructor.  Defined out of line, where \p NumericVector is a
+   * complete type.
+   */
+  virtual ~SumFactorizationShellMatrix ();
+
+  /**
+   * Sets the diffusion coefficient \f$ \kappa \f$ and the reaction
+   * coefficient \f$ \sigma \f$.  Must be called before \p init().
+   * The defaults give the Laplacian.
+   */
+  void set_coefficients (Real diffusion,
+                         Real reaction);
+
+  /**
+   * Computes the one dimensional shape function tables and the
+   * geometric factors of every active local element.  Must be
+   * called again whenever the mesh changes.
+   */
+  virtual void init () override;
+
+  virtual void clear () override;
+
+  /**
+   * \returns \p true if \p init() has been called since the last \p
+   * clear().
+   */
+  bool initialized () const { return _is_initialized; }
+
+  virtual numeric_index_type m () const override;
+
+  virtual numeric_index_type n () const override;
+
+  virtual void vector_mult (NumericVector<T> & dest,
+                            const NumericVector<T> & arg) const override;
+
+  virtual void vector_mult_add (NumericVector<T> & dest,
+                                const NumericVector<T> & arg) const override;
+
+  virtual void get_diagonal (NumericVector<T> & dest) const override;
+
+private:
+
+  /**
+   * Adds the unconstrained operator applied to the ghosted vector \p
+   * arg to \p dest, without closing it.
+   */
+  void add_action (NumericVector<T> & dest,
+                   const NumericVector<T> & arg) const;
+
+  /**
+   * The system we act on.
+   */
+  const System & _system;
+
+  /**
+   * The coefficients of the bilinear form.
+   */
+  Real _diffusion, _reaction;
+
+  /**
+   * The dimension of the mesh elements.
+   */
+  unsigned int _dim;
+
+  /**
+   * The number of one dimensional shape functions and quadrature
+   * points.
+   */
+  unsigned int _n_1d, _n_q1d;
+
+  /**
+   * One dimensional shape function values and derivatives, indexed
+   * by \p q*_n_1d+i.
+   */
+  std::vector<Real> _phi_1d, _dphi_1d;
+
+  /**
+   * The dof indices of each active local element, ordered
+   * lexicographically, \p _n_1d^_dim of them per element.
+   */
+  std::vector<numeric_index_type> _dof_indices;
+
+  /**
+   * Geometric factors of each active local element at each
+   * quadrature point: the \p _dim*(_dim+1)/2 entries of the symmetric
+   * matrix \f$ \kappa J^{-1} J^{-T} JxW \f$ followed by
+   * \f$ \sigma JxW \f$.
+   */
+  std::vector<Real> _geometry;
+
+  /**
+   * Work vectors for \p vector_mult_add(), built on first use and
+   * kept until \p clear(), so that Krylov iterations do not allocate:
+   * the ghosted copy of the argument, and, if there are constraints,
+   * the argument with constraints applied and the unconstrained
+   * result.
+   */
+  mutable std::unique_ptr<NumericVector<T>> _local_arg, _expanded_arg, _result;
+
+  bool _is_initialized;
+};
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_SUM_FACTORIZATION_SHELL_MATRIX_H
@@ -0,0 +1,179 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2021 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_THREADED_ASSEMBLY_H
+#define LIBMESH_THREADED_ASSEMBLY_H
+
+// Local includes
+#include "libmesh/system.h"
+#include "libmesh/dense_matrix.h"
+#include "libmesh/dense_vector.h"
+#include "libmesh/id_types.h"
+
+// C++ includes
+#include <memory>
+#include <vector>
+
+namespace libMesh
+{
+
+// forward declarations
+class Elem;
+class ImplicitSystem;
+
+/**
+ * This class drives the element-by-element assembly of an \p
+ * ImplicitSystem on all threads, for users of the classic \p
+ * System::attach_assemble_object() interface.  A derived class
+ * computes the matrix and right hand side contributions of a single
+ * element in \p assemble_element(); the driver loops over the active
+ * local elements with \p Threads::parallel_for(), applies the
+ * constraints and adds the results into the system matrix and right
+ * hand side.
+ *
+ * Each thread gets its own \p Scratch object, built by \p
+ * build_scratch(), which holds the element matrix, vector and dof
+ * indices.  Derived classes that need per-thread FE objects or other
+ * state should derive from \p Scratch and override \p
+ * build_scratch().  Finished element contributions are buffered per
+ * thread and inserted \p batch_size elements at a time, so the lock
+ * around the global data structures is taken once per batch rather
+ * than once per element.
+ *
+ * If \p deterministic is set, the contributions of chunks of \p
+ * batch_size elements per thread are instead computed on all threads
+ * into a shared buffer, without any lock, and then added by the
+ * calling thread in element order.  The results are then the same
+ * whatever the number of threads, at the cost of a serial insertion
+ * phase: none of the matrix and vector backends support concurrent
+ * insertion, so no path inserts without a lock.
+ *
+ * Only element contributions are assembled; SCALAR variable and
+ * other non-element terms must be added separately.
+ *
+ * \date 2021
+ * \brief Threaded element assembly driver for ImplicitSystem.
+ */
+class ThreadedAssembly : public System::Assembly
+{
+public:
+
+  /**
+   * Per-thread workspace for assembling one element.
+   */
+  class Scratch
+  {
+  public:
+    virtual ~Scratch () = default;
+
+    /**
+     * The element matrix, which \p assemble_element() should resize
+     * and fill.
+     */
+    DenseMatrix<Number> Ke;
+
+    /**
+     * The element right hand side, which \p assemble_element() should
+     * resize and fill.
+     */
+    DenseVector<Number> Fe;
+
+    /**
+     * The global dof indices of the rows and columns of \p Ke and
+     * \p Fe, which \p assemble_element() should fill.
+     */
+    std::vector<dof_id_type> dof_indices;
+  };
+
+  /**
+   * Constructor.  Assembles into the matrix and right hand side of
+   * \p sys.
+   */
+  explicit
+  ThreadedAssembly (ImplicitSystem & sys);
+
+  /**
+   * Destructor.
+   */
+  virtual ~ThreadedAssembly () = default;
+
+  /**
+   * Assembles all active local elements.
+   */
+  virtual void assemble () override;
+
+  /**
+   * \returns A new workspace for one thread.  Called once for each
+   * range of elements a thread assembles.
+   */
+  virtual std::unique_ptr<Scratch> build_scratch () const;
+
+  /**
+   * Computes the contributions of \p elem in \p scratch.  This is
+   * called concurrently from several threads, so it must not modify
+   * anything other than \p scratch.
+   */
+  virtual void assemble_element (const Elem & elem,
+                                 Scratch & scratch) const = 0;
+
+  /**
+   * \returns The system being assembled.
+   */
+  ImplicitSystem & get_system () const { return _system; }
+
+  /**
+   * Whether to assemble the system matrix.  Defaults to \p true.
+   */
+  bool assemble_matrix;
+
+  /**
+   * Whether to assemble the right hand side.  Defaults to \p true.
+   */
+  bool assemble_rhs;
+
+  /**
+   * Whether to apply the \p DofMap constraints to each element's
+   * contributions before they are added.  Defaults to \p true.
+   */
+  bool apply_constraints;
+
+  /**
+   * The number of element contributions each thread buffers before
+   * adding them to the global matrix and vector.  Defaults to 64.
+   */
+  unsigned int batch_size;
+
+  /**
+   * Whether to add all element contributions from the calling thread,
+   * in an order independent of the number of threads, rather than in
+   * locked batches.  Defaults to \p false.
+   */
+  bool deterministic;
+
+private:
+
+  /**
+   * The system being assembled.
+   */
+  ImplicitSystem & _system;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_THREADED_ASSEMBLY_H
@@ -0,0 +1,265 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2021 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_ARENA_ALLOCATOR_H
+#define LIBMESH_ARENA_ALLOCATOR_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/threads.h"
+
+// C++ includes
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace libMesh
+{
+
+/**
+ * A pooled allocator for very many small arrays, e.g. the index
+ * buffers of every \p DofObject in a mesh.  Requests are rounded up
+ * to a multiple of \p granularity bytes, and the arrays of each such
+ * size are carved one after another out of large slabs.  Allocating
+ * an array therefore usually involves no call to the system
+ * allocator and no per-allocation header, and arrays allocated in
+ * sequence, like those of consecutively built nodes, end up next to
+ * each other in memory.  This is a drop-in allocator, not a
+ * different storage layout: containers using it keep their own
+ * headers, and are still addressed through pointers.
+ *
+ * Each slab keeps its own list of freed arrays, which are reused
+ * before the rest of the slab, and a count of the arrays still in
+ * use.  A slab is returned to the system as soon as all of its
+ * arrays are freed, unless it is the last one with free room for its
+ * size, which is kept to avoid thrashing.  Requests larger than \p
+ * max_pooled_bytes() go straight to the system allocator.
+ *
+ * All methods are thread-safe.  To keep threads from contending for
+ * one lock, the pool has \p n_shards independent sets of size
+ * classes, each with its own locks; a thread allocates from the
+ * shard its id hashes to, and an array freed by another thread goes
+ * back to the slab, and so the shard, it came from.
+ *
+ * \date 2021
+ * \brief Sharded size-class slab pool for small arrays.
+ */
+class ArenaPool
+{
+public:
+
+  /**
+   * Constructor.  Requests of up to \p max_pooled_bytes bytes will be
+   * pooled, in slabs of \p slab_bytes bytes, which must be a power of
+   * two large enough for a few of the largest arrays.
+   */
+  ArenaPool (std::size_t max_pooled_bytes,
+             std::size_t slab_bytes);
+
+  /**
+   * Destructor.  Returns all slabs to the system; every array must
+   * have been returned to the pool first.
+   */
+  ~ArenaPool ();
+
+  ArenaPool (const ArenaPool &) = delete;
+  ArenaPool & operator= (const ArenaPool &) = delete;
+
+  /**
+   * \returns The pool shared by all \p ArenaAllocators, for arrays of
+   * up to 256 bytes.
+   */
+  static ArenaPool & instance ();
+
+  /**
+   * \returns The pool for \p Node and \p Elem objects when the
+   * library is configured with --enable-mesh-object-arena.  Its slabs
+   * are large enough for thousands of objects each, and since every
+   * element type has its own size, elements of one type end up packed
+   * together.
+   */
+  static ArenaPool & mesh_object_instance ();
+
+  /**
+   * \returns Memory for \p bytes bytes, aligned for any type no
+   * larger than \p granularity.
+   */
+  void * allocate (std::size_t bytes);
+
+  /**
+   * Returns the memory at \p p, which was allocated for \p bytes
+   * bytes, to the pool.
+   */
+  void deallocate (void * p, std::size_t bytes);
+
+  /**
+   * \returns The number of bytes of slabs the pool currently holds.
+   */
+  std::size_t bytes_reserved () const;
+
+  /**
+   * \returns The size above which allocations are not pooled.
+   */
+  std::size_t max_pooled_bytes () const { return _max_pooled_bytes; }
+
+  /**
+   * \returns The size of each slab.
+   */
+  std::size_t slab_bytes () const { return _slab_bytes; }
+
+  /**
+   * \returns The number of bytes of each slab used for arrays.
+   */
+  std::size_t usable_slab_bytes () const;
+
+  /**
+   * Allocation sizes are rounded up to a multiple of this.
+   */
+  static const std::size_t granularity = 8;
+
+  /**
+   * The number of independent sets of size classes threads allocate
+   * from.
+   */
+  static const unsigned int n_shards = 8;
+
+private:
+
+  struct SizeClass;
+
+  /**
+   * An unused array, on a free list.
+   */
+  struct FreeBlock
+  {
+    FreeBlock * next;
+  };
+
+  /**
+   * The header at the start of each slab.  Slabs are aligned to \p
+   * _slab_bytes, so an array's slab is found by rounding its address
+   * down.
+   */
+  struct Slab
+  {
+    // The memory to give back to the system
+    void * memory;
+
+    SizeClass * size_class;
+
+    // Freed arrays, and the start of the never used end of the slab
+    FreeBlock * free_list;
+    char * next;
+
+    // The number of arrays in use
+    std::size_t n_used;
+
+    // Neighbors in the list of slabs of our size class with room
+    Slab * prev_available;
+    Slab * next_available;
+  };
+
+  /**
+   * The slabs for arrays of one size, in one shard.
+   */
+  struct SizeClass
+  {
+    Threads::spin_mutex mutex;
+
+    std::size_t block_bytes;
+
+    // The slabs which have room for another array
+    Slab * available;
+  };
+
+  /**
+   * \returns Whether \p slab has no room for another array.
+   */
+  bool full (const Slab & slab) const;
+
+  void link_available (Slab & slab);
+
+  void unlink_available (Slab & slab);
+
+  const std::size_t _max_pooled_bytes;
+
+  const std::size_t _slab_bytes;
+
+  const std::size_t _n_classes;
+
+  // The size classes of each shard, one after another
+  std::unique_ptr<SizeClass[]> _classes;
+
+  std::atomic<std::size_t> _n_slabs;
+};
+
+
+
+/**
+ * A standard allocator which takes its memory from the shared \p
+ * ArenaPool.  Containers using it cost a few bytes less per
+ * allocation than with \p std::allocator, and their storage is
+ * packed into contiguous slabs, which is worthwhile for very many
+ * small, long-lived containers.
+ *
+ * \date 2021
+ * \brief Allocator drawing from the shared ArenaPool.
+ */
+template <typename T>
+class ArenaAllocator
+{
+public:
+  typedef T value_type;
+
+  static_assert(alignof(T) <= ArenaPool::granularity,
+                "ArenaAllocator cannot align this type");
+
+  ArenaAllocator () = default;
+
+  template <typename U>
+  ArenaAllocator (const ArenaAllocator<U> &) {}
+
+  T * allocate (std::size_t n)
+  { return static_cast<T *>(ArenaPool::instance().allocate(n * sizeof(T))); }
+
+  void deallocate (T * p, std::size_t n)
+  { ArenaPool::instance().deallocate(p, n * sizeof(T)); }
+};
+
+
+
+template <typename T, typename U>
+inline
+bool operator== (const ArenaAllocator<T> &, const ArenaAllocator<U> &)
+{
+  return true;
+}
+
+
+
+template <typename T, typename U>
+inline
+bool operator!= (const ArenaAllocator<T> &, const ArenaAllocator<U> &)
+{
+  return false;
+}
+
+} // namespace libMesh
+
+#endif // LIBMESH_ARENA_ALLOCATOR_H
@@ -0,0 +1,193 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2021 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_COMPRESSED_STREAM_H
+#define LIBMESH_COMPRESSED_STREAM_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <cstdio>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * A stream buffer which compresses everything written to it into a
+ * file, or decompresses a file as it is read, in a single pass, using
+ * the bzip2 or xz libraries directly.  This is the equivalent of the
+ * gzstream contrib package for the .bz2 and .xz formats, and avoids
+ * running external programs on temporary copies of a file.  Xdr uses
+ * it for the text READ and WRITE modes; the binary ENCODE and DECODE
+ * modes never compress.
+ *
+ * When compressing .xz files and more than one libMesh thread is in
+ * use, the stream is compressed in independent blocks by that many
+ * threads.  Decompression reads files of several concatenated
+ * streams, such as those written by parallel compressors.
+ *
+ * \date 2021
+ * \brief Streaming bzip2/xz (de)compression buffer.
+ */
+class CompressedStreamBuf : public std::streambuf
+{
+public:
+  enum Format { BZIP2, XZ };
+
+  /**
+   * Opens the file \p name, in the compression format \p format, for
+   * reading if \p writing is false and for writing otherwise.
+   */
+  CompressedStreamBuf (const std::string & name,
+                       Format format,
+                       bool writing);
+
+  /**
+   * Destructor.  Finishes compression and closes the file if close()
+   * wasn't called, printing any failure since it can't throw.  Call
+   * close() to find out whether a written file is complete.
+   */
+  virtual ~CompressedStreamBuf ();
+
+  /**
+   * \returns \p true if the file was opened successfully.
+   */
+  bool is_open () const { return _file != nullptr; }
+
+  /**
+   * Finishes compression, if writing, and closes the file.
+   * \returns \p false if writing or closing the file failed, and
+   * throws if the compression library reports an error.
+   */
+  bool close ();
+
+  /**
+   * \returns \p true if this build of the library can stream files of
+   * format \p format.
+   */
+  static bool available (Format format);
+
+  /**
+   * \returns \p true, and sets \p format, if the name of \p file has
+   * the extension of a compression format we can stream.
+   */
+  static bool format_of (const std::string & file, Format & format);
+
+  /**
+   * The interface to a compression library; an implementation
+   * detail, defined with the libraries.
+   */
+  struct Codec;
+
+protected:
+  virtual int_type underflow () override;
+
+  virtual int_type overflow (int_type c) override;
+
+  virtual int sync () override;
+
+private:
+  /**
+   * Compresses everything written so far, finishing the compressed
+   * stream if \p finish is true.  \returns \p false on failure.
+   */
+  bool compress (bool finish);
+
+  std::unique_ptr<Codec> _codec;
+
+  std::FILE * _file;
+
+  const bool _writing;
+
+  /**
+   * Decompressed data, as read or waiting to be written.
+   */
+  std::vector<char> _plain;
+
+  /**
+   * Compressed data, as read from or to be written to the file.
+   */
+  std::vector<char> _packed;
+
+  /**
+   * When reading, the unused part of \p _packed.
+   */
+  const char * _packed_next;
+  std::size_t _packed_left;
+
+  /**
+   * When reading, have we reached the end of the file or the data?
+   */
+  bool _file_done, _data_done;
+};
+
+
+
+/**
+ * An input stream which decompresses a .bz2 or .xz file.
+ *
+ * \date 2021
+ * \brief Decompressing input file stream.
+ */
+class CompressedIStream : public std::istream
+{
+public:
+  CompressedIStream (const std::string & name,
+                     CompressedStreamBuf::Format format);
+
+private:
+  CompressedStreamBuf _buf;
+};
+
+
+
+/**
+ * An output stream which writes a compressed .bz2 or .xz file.  Call
+ * close() and check for failure to make sure the file is complete;
+ * the destructor can only print an error.
+ *
+ * \date 2021
+ * \brief Compressing output file stream.
+ */
+class CompressedOStream : public std::ostream
+{
+public:
+  CompressedOStream (const std::string & name,
+                     CompressedStreamBuf::Format format);
+
+  /**
+   * Finishes and closes the file, setting failbit on failure.  Any
+   * earlier write error has already set badbit.
+   */
+  void close ();
+
+private:
+  CompressedStreamBuf _buf;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_COMPRESSED_STREAM_H
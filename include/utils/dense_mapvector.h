@@ -0,0 +1,398 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2021 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_DENSE_MAPVECTOR_H
+#define LIBMESH_DENSE_MAPVECTOR_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <cstddef>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * This \p dense_mapvector templated class is a drop-in alternative
+ * to \p mapvector for use with DistributedMesh.  Values whose indices
+ * fall in one contiguous "dense" window, typically the ids of the
+ * objects owned by this processor, are stored in a std::vector, so
+ * looking them up takes constant time and iterating over them walks
+ * contiguous memory.  Values with any other indices, typically those
+ * of ghost objects, are stored in an overflow std::map.
+ *
+ * The window grows when a value is added just past its end, leaving
+ * a gap of fewer than \p dense_gap unused slots, so the window never
+ * takes more memory per value than a map node would.  \p repack()
+ * moves the window to the largest cluster of nearly consecutive
+ * indices, and should be called after indices are renumbered or
+ * many values are erased.
+ *
+ * Iteration is in order of increasing index, as with \p mapvector.
+ * Default-valued (e.g. nullptr) entries in the window are treated as
+ * absent and are skipped.  Iterators remain valid when values are
+ * added or other values erased, except across \p repack() and \p
+ * clear().
+ *
+ * \date 2021
+ * \brief Vector-backed mapvector alternative for mostly dense indices.
+ */
+template <typename Val, typename index_t=unsigned int>
+class dense_mapvector
+{
+public:
+  typedef std::map<index_t, Val> maptype;
+
+  /**
+   * The window is only extended over gaps smaller than this.
+   */
+  static const std::size_t dense_gap = 8;
+
+  dense_mapvector () : _offset(0) {}
+
+  Val & operator[] (const index_t & k)
+  {
+    const std::size_t n = _dense.size();
+    if (n && k >= _offset && k - _offset < n)
+      return _dense[k - _offset];
+
+    // Grow the window to take k, unless that would leave a large gap
+    // or cover indices already in the overflow map
+    if (!n || (k >= _offset + n && k - (_offset + n) < dense_gap))
+      {
+        const index_t first_new = n ? index_t(_offset + n) : k;
+        typename maptype::const_iterator it = _overflow.lower_bound(first_new);
+        if (it == _overflow.end() || it->first > k)
+          {
+            if (!n)
+              _offset = k;
+            _dense.resize(k - _offset + 1, Val());
+            return _dense.back();
+          }
+      }
+
+    return _overflow[k];
+  }
+
+  Val operator[] (const index_t & k) const
+  {
+    if (k >= _offset && k - _offset < _dense.size())
+      return _dense[k - _offset];
+
+    typename maptype::const_iterator it = _overflow.find(k);
+    return it == _overflow.end() ? Val() : it->second;
+  }
+
+  class const_veclike_iterator;
+
+  class veclike_iterator
+  {
+  public:
+    veclike_iterator(const veclike_iterator & i) = default;
+
+    Val & operator*() const
+    { return _i == npos ? _mit->second : _c->_dense[_i]; }
+
+    veclike_iterator & operator++() { _c->increment(*_c, _i, _mit); return *this; }
+
+    veclike_iterator operator++(int) {
+      veclike_iterator i = *this;
+      ++(*this);
+      return i;
+    }
+
+    bool operator==(const veclike_iterator & other) const {
+      return _i == other._i && (_i != npos || _mit == other._mit);
+    }
+
+    bool operator!=(const veclike_iterator & other) const {
+      return !(*this == other);
+    }
+
+    /**
+     * \returns The index of the current value.
+     */
+    index_t index() const
+    { return _i == npos ? _mit->first : index_t(_c->_offset + _i); }
+
+  private:
+    friend class dense_mapvector;
+    friend class const_veclike_iterator;
+
+    veclike_iterator(dense_mapvector * c,
+                     std::size_t i,
+                     const typename maptype::iterator & mit)
+      : _c(c), _i(i), _mit(mit) {}
+
+    dense_mapvector * _c;
+    std::size_t _i;
+    typename maptype::iterator _mit;
+  };
+
+  class const_veclike_iterator
+  {
+  public:
+    const_veclike_iterator(const const_veclike_iterator & i) = default;
+
+    const_veclike_iterator(const veclike_iterator & i)
+      : _c(i._c), _i(i._i), _mit(i._mit) {}
+
+    const Val & operator*() const
+    { return _i == npos ? _mit->second : _c->_dense[_i]; }
+
+    const_veclike_iterator & operator++() { _c->increment(*_c, _i, _mit); return *this; }
+
+    const_veclike_iterator operator++(int) {
+      const_veclike_iterator i = *this;
+      ++(*this);
+      return i;
+    }
+
+    bool operator==(const const_veclike_iterator & other) const {
+      return _i == other._i && (_i != npos || _mit == other._mit);
+    }
+
+    bool operator!=(const const_veclike_iterator & other) const {
+      return !(*this == other);
+    }
+
+    /**
+     * \returns The index of the current value.
+     */
+    index_t index() const
+    { return _i == npos ? _mit->first : index_t(_c->_offset + _i); }
+
+  private:
+    friend class dense_mapvector;
+
+    const_veclike_iterator(const dense_mapvector * c,
+                           std::size_t i,
+                           const typename maptype::const_iterator & mit)
+      : _c(c), _i(i), _mit(mit) {}
+
+    const dense_mapvector * _c;
+    std::size_t _i;
+    typename maptype::const_iterator _mit;
+  };
+
+  void erase(index_t k) {
+    if (k >= _offset && k - _offset < _dense.size())
+      _dense[k - _offset] = Val();
+    else
+      _overflow.erase(k);
+  }
+
+  veclike_iterator erase(const veclike_iterator & pos) {
+    veclike_iterator next = pos;
+    ++next;
+    if (pos._i == npos)
+      _overflow.erase(pos._mit);
+    else
+      _dense[pos._i] = Val();
+    return next;
+  }
+
+  veclike_iterator begin() {
+    return this->begin_impl<veclike_iterator>(*this);
+  }
+
+  const_veclike_iterator begin() const {
+    return this->begin_impl<const_veclike_iterator>(*this);
+  }
+
+  veclike_iterator end() {
+    return veclike_iterator(this, npos, _overflow.end());
+  }
+
+  const_veclike_iterator end() const {
+    return const_veclike_iterator(this, npos, _overflow.end());
+  }
+
+  void clear() {
+    _dense.clear();
+    _overflow.clear();
+    _offset = 0;
+  }
+
+  /**
+   * \returns One past the largest index with a non-default value, or
+   * zero if there are none.
+   */
+  index_t end_index() const
+  {
+    const index_t dense_end = _offset + _dense.size();
+
+    typename maptype::const_reverse_iterator rit = _overflow.rbegin();
+    for (; rit != _overflow.rend() &&
+           (_dense.empty() || rit->first >= dense_end); ++rit)
+      if (rit->second != Val())
+        return rit->first + 1;
+
+    for (std::size_t j = _dense.size(); j; --j)
+      if (_dense[j-1] != Val())
+        return _offset + j;
+
+    for (; rit != _overflow.rend(); ++rit)
+      if (rit->second != Val())
+        return rit->first + 1;
+
+    return 0;
+  }
+
+  /**
+   * Drops all default-valued entries, and moves the dense window to
+   * the longest run of indices separated by gaps of at most \p
+   * dense_gap.  Invalidates all iterators.
+   */
+  void repack()
+  {
+    std::vector<std::pair<index_t, Val>> entries;
+    for (const_veclike_iterator it = this->begin(), end = this->end();
+         it != end; ++it)
+      if (*it != Val())
+        entries.emplace_back(it.index(), *it);
+
+    std::size_t best_begin = 0, best_end = 0, run_begin = 0;
+    for (std::size_t j = 0; j != entries.size(); ++j)
+      {
+        if (j && entries[j].first - entries[j-1].first > dense_gap)
+          run_begin = j;
+        if (j + 1 - run_begin > best_end - best_begin)
+          {
+            best_begin = run_begin;
+            best_end = j + 1;
+          }
+      }
+
+    // Swap rather than clear, so the old capacity is released
+    std::vector<Val> dense;
+    _overflow.clear();
+    _offset = 0;
+
+    if (best_end != best_begin)
+      {
+        _offset = entries[best_begin].first;
+        dense.resize(entries[best_end-1].first - _offset + 1, Val());
+      }
+
+    for (std::size_t j = 0; j != entries.size(); ++j)
+      if (j >= best_begin && j < best_end)
+        dense[entries[j].first - _offset] = entries[j].second;
+      else
+        _overflow.emplace_hint(_overflow.end(), entries[j]);
+
+    _dense.swap(dense);
+  }
+
+  /**
+   * \returns The number of indices covered by the dense window.
+   */
+  std::size_t dense_size() const { return _dense.size(); }
+
+  /**
+   * \returns The number of values stored outside the dense window.
+   */
+  std::size_t overflow_size() const { return _overflow.size(); }
+
+private:
+
+  static const std::size_t npos = static_cast<std::size_t>(-1);
+
+  /**
+   * \returns The position of the first non-default value in the
+   * window at or after position \p j, or \p npos.
+   */
+  std::size_t next_dense (std::size_t j) const
+  {
+    for (const std::size_t n = _dense.size(); j < n; ++j)
+      if (_dense[j] != Val())
+        return j;
+    return npos;
+  }
+
+  /**
+   * Positions are a window position \p i, or \p npos and an overflow
+   * map iterator.  Overflow values below the window come first, then
+   * the window, then overflow values above it.
+   */
+  template <typename Iterator, typename Container>
+  static Iterator begin_impl (Container & c)
+  {
+    auto mit = c._overflow.begin();
+    if (mit != c._overflow.end() && mit->first < c._offset)
+      return Iterator(&c, npos, mit);
+
+    const std::size_t i = c.next_dense(0);
+    if (i != npos)
+      return Iterator(&c, i, c._overflow.end());
+
+    return Iterator(&c, npos, mit);
+  }
+
+  template <typename Container, typename MapIterator>
+  static void increment (Container & c,
+                         std::size_t & i,
+                         MapIterator & mit)
+  {
+    if (i != npos)
+      {
+        i = c.next_dense(i+1);
+        if (i == npos)
+          mit = c._overflow.lower_bound(index_t(c._offset + c._dense.size()));
+        return;
+      }
+
+    libmesh_assert(mit != c._overflow.end());
+    const bool below = mit->first < c._offset;
+    ++mit;
+    if (below && (mit == c._overflow.end() || mit->first >= c._offset))
+      i = c.next_dense(0);
+  }
+
+  /**
+   * The first index in the window.
+   */
+  index_t _offset;
+
+  /**
+   * Values for indices _offset to _offset + _dense.size() - 1.
+   */
+  std::vector<Val> _dense;
+
+  /**
+   * Values for all other indices.
+   */
+  maptype _overflow;
+};
+
+
+
+template <typename Val, typename index_t>
+const std::size_t dense_mapvector<Val, index_t>::dense_gap;
+
+template <typename Val, typename index_t>
+const std::size_t dense_mapvector<Val, index_t>::npos;
+
+} // namespace libMesh
+
+#endif // LIBMESH_DENSE_MAPVECTOR_H
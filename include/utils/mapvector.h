@@ -77,6 +77,8 @@ public:
       return it != other.it;
     }
 
+    index_t index() const { return it->first; }
+
     typename maptype::iterator it;
   };
 
@@ -110,6 +112,8 @@ public:
       return it != other.it;
     }
 
+    index_t index() const { return it->first; }
+
     typename maptype::const_iterator it;
   };
 
@@ -136,6 +140,31 @@ public:
   const_veclike_iterator end() const {
     return const_veclike_iterator(maptype::end());
   }
+
+  /**
+   * \returns One past the largest index with a non-default value, or
+   * zero if there are none.
+   */
+  index_t end_index() const {
+    for (typename maptype::const_reverse_iterator rit = this->rbegin();
+         rit != this->rend(); ++rit)
+      if (rit->second != Val())
+        return rit->first + 1;
+    return 0;
+  }
+
+  /**
+   * Drops all default-valued entries.  Provided for compatibility
+   * with \p dense_mapvector.
+   */
+  void repack() {
+    for (typename maptype::iterator it = maptype::begin();
+         it != maptype::end();)
+      if (it->second == Val())
+        it = maptype::erase(it);
+      else
+        ++it;
+  }
 };
 
 } // namespace libMesh
@@ -77,17 +77,46 @@ public:
   Xdr (const std::string & name="", const XdrMODE m=UNKNOWN);
 
   /**
-   * Destructor.  Closes the file if it is open.
+   * Constructor.  Reads from or writes to \p buffer in memory rather
+   * than to a file; the bytes are exactly those which would be in a
+   * file written with the same mode.  When reading, \p buffer must
+   * stay unchanged while the object is open.  When writing, \p
+   * buffer is filled in by \p close().
+   */
+  Xdr (std::vector<char> & buffer, const XdrMODE m);
+
+  /**
+   * Destructor.  Closes the file if it is open, printing any error
+   * since it can't throw; call close() to catch a file which couldn't
+   * be finished.
    */
   ~Xdr ();
 
   /**
-   * Opens the file.
+   * Opens the file.  In READ and WRITE mode, a name ending in .gz,
+   * .bz2 or .xz means a compressed file.  ENCODE and DECODE mode
+   * files are never compressed, whatever their name.
    */
   void open (const std::string & name);
 
   /**
-   * Closes the file if it is open.
+   * Opens the file for DECODE by mapping it into memory, where the
+   * platform allows, rather than reading it through a \p FILE.
+   * Several processors may then map the same file at little cost,
+   * and data_stream() decodes blocks of 4- and 8-byte values in bulk
+   * straight from the mapping.  Otherwise this is the same as open().
+   */
+  void open_mapped (const std::string & name);
+
+  /**
+   * \returns \p true if the file being read is mapped into memory.
+   */
+  bool is_mapped () const;
+
+  /**
+   * Closes the file if it is open.  A file being written in WRITE
+   * mode, compressed or not, is finished first, and failing to
+   * finish it is an error.
    */
   void close();
 
@@ -167,6 +196,26 @@ public:
 
 private:
 
+  /**
+   * Opens the in-memory buffer.
+   */
+  void open_buffer ();
+
+  /**
+   * When reading a mapped file, skips \p n_bytes past the current
+   * position and restarts \p xdrs there; an XDR memory stream can
+   * only address 32-bit offsets.  Does nothing otherwise.
+   */
+  void advance_window (const std::size_t n_bytes = 0);
+
+  /**
+   * When reading a mapped file, decodes \p len values straight from
+   * the mapping if each is encoded in as many bytes as a \p T.
+   * \returns \p false, having done nothing, otherwise.
+   */
+  template <typename T>
+  bool decode_mapped (T * val, const unsigned int len);
+
   /**
    * Helper method for reading different data types
    */
@@ -220,8 +269,28 @@ private:
    */
   FILE * fp;
 
+  /**
+   * The file mapped by open_mapped(), if any, its size, and the
+   * offset in it at which \p xdrs starts.
+   */
+  const char * map_data;
+  std::size_t map_size, map_offset;
+
+  /**
+   * The growing buffer behind \p fp when encoding into \p
+   * mem_buffer, and its size, as kept up to date by the stream.
+   */
+  char * stream_data;
+  std::size_t stream_size;
+
 #endif
 
+  /**
+   * The buffer we are reading from or writing to, or nullptr if we
+   * are using a file.
+   */
+  std::vector<char> * mem_buffer;
+
   /**
    * The input file stream.
    */
@@ -239,7 +308,10 @@ private:
   char comm[xdr_MAX_STRING_LENGTH];
 
   /**
-   * Are we reading/writing zipped files?
+   * Are we reading/writing zipped files?  Only the text READ and
+   * WRITE modes handle compressed files.  The bzip2 and xz flags are
+   * only set when those files go through the external programs
+   * rather than a \p CompressedStreamBuf.
    */
   bool gzipped_file, bzipped_file, xzipped_file;
 
@@ -65,6 +65,9 @@ AS_ECHO(["  library deprecated code support.. : $enabledeprecated"])
 AS_ECHO(["  adaptive mesh refinement......... : $enableamr"])
 AS_ECHO(["  blocked matrix/vector storage.... : $enableblockedstorage"])
 AS_ECHO(["  complex variables................ : $enablecomplex"])
+AS_ECHO(["  DofObject index pools............ : $enabledofobjectarena"])
+AS_ECHO(["  dense DistributedMesh containers. : $enabledensemeshcontainers"])
+AS_ECHO(["  Node and Elem pools.............. : $enablemeshobjectarena"])
 AS_ECHO(["  example suite.................... : $enableexamples"])
 AS_ECHO(["  ghosted vectors.................. : $enableghosted"])
 AS_ECHO(["  high-order shape functions....... : $enablepfem"])
@@ -162,6 +162,7 @@ AC_CXX_RTTI
 AC_CHECK_HEADERS(getopt.h)
 AC_CHECK_HEADERS(csignal)
 AC_CHECK_HEADERS(sys/resource.h)
+AC_CHECK_HEADERS(sys/mman.h)
 AC_CXX_HAVE_LOCALE
 AC_CXX_HAVE_SSTREAM
 
@@ -130,6 +130,63 @@ AS_IF([test "$enableblockedstorage" != no],
 # --------------------------------------------------------------
 
 
+# --------------------------------------------------------------
+# pooled DofObject index storage - disabled by default
+# --------------------------------------------------------------
+AC_ARG_ENABLE(dof-object-arena,
+              [AS_HELP_STRING([--enable-dof-object-arena],[Allocate DofObject index buffers from contiguous memory pools])],
+              [AS_CASE("${enableval}",
+                       [yes], [enabledofobjectarena=yes],
+                       [no],  [enabledofobjectarena=no],
+                       [AC_MSG_ERROR(bad value ${enableval} for --enable-dof-object-arena)])],
+              [enabledofobjectarena=no])
+
+AS_IF([test "$enabledofobjectarena" != no],
+      [
+        AC_MSG_RESULT([<<< Configuring library to pool DofObject index buffers >>>])
+        AC_DEFINE(ENABLE_DOF_OBJECT_ARENA, 1, [Flag indicating if the library should allocate DofObject index buffers from memory pools])
+      ])
+# --------------------------------------------------------------
+
+
+# --------------------------------------------------------------
+# pooled Node and Elem storage - disabled by default
+# --------------------------------------------------------------
+AC_ARG_ENABLE(mesh-object-arena,
+              [AS_HELP_STRING([--enable-mesh-object-arena],[Allocate Node and Elem objects from contiguous memory pools])],
+              [AS_CASE("${enableval}",
+                       [yes], [enablemeshobjectarena=yes],
+                       [no],  [enablemeshobjectarena=no],
+                       [AC_MSG_ERROR(bad value ${enableval} for --enable-mesh-object-arena)])],
+              [enablemeshobjectarena=no])
+
+AS_IF([test "$enablemeshobjectarena" != no],
+      [
+        AC_MSG_RESULT([<<< Configuring library to pool Node and Elem objects >>>])
+        AC_DEFINE(ENABLE_MESH_OBJECT_ARENA, 1, [Flag indicating if the library should allocate Node and Elem objects from memory pools])
+      ])
+# --------------------------------------------------------------
+
+
+# --------------------------------------------------------------
+# vector-backed DistributedMesh containers - disabled by default
+# --------------------------------------------------------------
+AC_ARG_ENABLE(dense-mesh-containers,
+              [AS_HELP_STRING([--enable-dense-mesh-containers],[Store DistributedMesh nodes and elements in vectors indexed by id, with maps only for outlying ids])],
+              [AS_CASE("${enableval}",
+                       [yes], [enabledensemeshcontainers=yes],
+                       [no],  [enabledensemeshcontainers=no],
+                       [AC_MSG_ERROR(bad value ${enableval} for --enable-dense-mesh-containers)])],
+              [enabledensemeshcontainers=no])
+
+AS_IF([test "$enabledensemeshcontainers" != no],
+      [
+        AC_MSG_RESULT([<<< Configuring library with vector-backed DistributedMesh containers >>>])
+        AC_DEFINE(ENABLE_DENSE_MESH_CONTAINERS, 1, [Flag indicating if DistributedMesh should store nodes and elements in dense_mapvector containers])
+      ])
+# --------------------------------------------------------------
+
+
 # --------------------------------------------------------------
 # legacy include paths - disabled by default
 # --------------------------------------------------------------
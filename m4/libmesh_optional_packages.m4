@@ -386,6 +386,17 @@ AC_ARG_ENABLE(bzip2,
 
 AS_IF([test "$enablebz2" != no],
       [
+        dnl Prefer streaming through libbz2 to running the programs
+        AC_CHECK_HEADER(bzlib.h,
+                        [
+                          AC_CHECK_LIB(bz2, BZ2_bzCompressInit,
+                                       [
+                                         AC_MSG_RESULT(<<< Using libbz2 for streaming compressed .bz2 files >>>)
+                                         AC_DEFINE(HAVE_LIBBZ2, 1, [Flag indicating libbz2 is available for streaming compressed .bz2 files])
+                                         libmesh_optional_LIBS="-lbz2 $libmesh_optional_LIBS"
+                                       ])
+                        ])
+
         AC_CHECK_PROG(BZIP2,bzip2,bzip2,none,$PATH)
         AS_IF([test "$BZIP2" = bzip2],
               [
@@ -411,6 +422,17 @@ AC_ARG_ENABLE(xz,
 
 AS_IF([test "$enablexz" != no],
       [
+        dnl Prefer streaming through liblzma to running the program
+        AC_CHECK_HEADER(lzma.h,
+                        [
+                          AC_CHECK_LIB(lzma, lzma_stream_decoder,
+                                       [
+                                         AC_MSG_RESULT(<<< Using liblzma for streaming compressed .xz files >>>)
+                                         AC_DEFINE(HAVE_LIBLZMA, 1, [Flag indicating liblzma is available for streaming compressed .xz files])
+                                         libmesh_optional_LIBS="-llzma $libmesh_optional_LIBS"
+                                       ])
+                        ])
+
         AC_CHECK_PROG(XZ,xz,xz,none,$PATH)
         AS_IF([test "$XZ" = xz],
               [
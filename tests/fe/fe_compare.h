@@ -0,0 +1,87 @@
+#ifndef __fe_compare_h__
+#define __fe_compare_h__
+
+#include <libmesh/elem.h>
+#include <libmesh/fe_base.h>
+#include <libmesh/int_range.h>
+#include <libmesh/unstructured_mesh.h>
+#include <libmesh/mesh_generation.h>
+#include <libmesh/mesh_modification.h>
+
+#include "libmesh_cppunit.h"
+
+using namespace libMesh;
+
+// Helpers for tests which check that some faster way of
+// reinitializing an FE object gives what the usual way does.
+namespace FECompare
+{
+
+// Builds an n^dim mesh of \p elem_type elements on the unit cube,
+// distorted so that geometry-dependent quantities really have to be
+// recomputed on each element.
+inline void build_distorted_mesh (UnstructuredMesh & mesh,
+                                  const ElemType elem_type,
+                                  const unsigned int n)
+{
+  const unsigned int dim = Elem::build(elem_type)->dim();
+
+  MeshTools::Generation::build_cube (mesh,
+                                     n, n*(dim>1), n*(dim>2),
+                                     0., 1., 0., 1., 0., 1.,
+                                     elem_type);
+
+  MeshTools::Modification::distort(mesh, 0.2);
+}
+
+// Asks \p fe for everything compare() checks.  This has to happen
+// before \p fe is first reinitialized.
+inline void request_all (const FEBase & fe)
+{
+  fe.get_phi();
+  fe.get_dphi();
+  fe.get_JxW();
+  fe.get_xyz();
+}
+
+// Checks that \p actual holds the same values as \p expected, both
+// having been prepared with request_all() and reinitialized on the
+// same element.
+inline void compare (const FEBase & expected,
+                     const FEBase & actual)
+{
+  const Real tol = TOLERANCE*TOLERANCE;
+
+  const std::vector<std::vector<Real>> & phi = expected.get_phi();
+  const std::vector<std::vector<Real>> & actual_phi = actual.get_phi();
+  const std::vector<std::vector<RealGradient>> & dphi = expected.get_dphi();
+  const std::vector<std::vector<RealGradient>> & actual_dphi = actual.get_dphi();
+  const std::vector<Real> & JxW = expected.get_JxW();
+  const std::vector<Real> & actual_JxW = actual.get_JxW();
+  const std::vector<Point> & xyz = expected.get_xyz();
+  const std::vector<Point> & actual_xyz = actual.get_xyz();
+
+  CPPUNIT_ASSERT_EQUAL(JxW.size(), actual_JxW.size());
+  for (auto qp : index_range(JxW))
+    {
+      LIBMESH_ASSERT_FP_EQUAL(JxW[qp], actual_JxW[qp], tol);
+      for (unsigned int d=0; d != LIBMESH_DIM; ++d)
+        LIBMESH_ASSERT_FP_EQUAL(xyz[qp](d), actual_xyz[qp](d), tol);
+    }
+
+  CPPUNIT_ASSERT_EQUAL(phi.size(), actual_phi.size());
+  for (auto i : index_range(phi))
+    {
+      CPPUNIT_ASSERT_EQUAL(phi[i].size(), actual_phi[i].size());
+      for (auto qp : index_range(phi[i]))
+        {
+          LIBMESH_ASSERT_FP_EQUAL(phi[i][qp], actual_phi[i][qp], tol);
+          for (unsigned int d=0; d != LIBMESH_DIM; ++d)
+            LIBMESH_ASSERT_FP_EQUAL(dphi[i][qp](d), actual_dphi[i][qp](d), tol);
+        }
+    }
+}
+
+} // namespace FECompare
+
+#endif // __fe_compare_h__